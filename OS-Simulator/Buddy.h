@@ -0,0 +1,335 @@
+/*
+  Title          : Buddy.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "BuddyMemory" class
+  Purpose        : Class project
+*/
+#ifndef __BUDDY_H__
+#define __BUDDY_H__
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "MemoryBackend.h"
+
+using namespace std;
+
+/*
+Buddy system::
+
+The buddy system allocates memory from a segment of physically contiguous
+pages in units sized as a power of 2. A request is rounded up to the next
+power of 2; if no free block of that size exists, a larger one is split in
+two halves, the buddies, again and again until one has the right size.
+When a block is freed and its buddy is free too, the two are coalesced
+into the block they came from, which may coalesce with its own buddy, and
+so on.
+
+A block of 2^k bytes starts at a multiple of 2^k, so its buddy is the
+address with bit k flipped: start XOR 2^k. The free blocks of each size
+(each order k) are kept in their own list, ordered by address, so a split
+or a coalesce takes one step per order: O(log n) for a memory of n bytes.
+
+A memory size that is not a power of 2 is split into its binary digits,
+largest first: 1000 bytes are blocks of 512, 256, 128, 64, 32 and 8 at
+0, 512, 768, 896, 960 and 992. Each of these starts at a multiple of its
+size, so the XOR rule holds across the whole memory; a block whose buddy
+would end past the memory has no buddy and is never coalesced.
+
+Rounding up wastes the rest of each block: the internal fragmentation.
+*/
+class BuddyMemory : public MemoryBackend{
+public:
+    // Default constructor.
+    BuddyMemory() = default;
+    BuddyMemory(const BuddyMemory &rhs) = delete;
+    BuddyMemory& operator=(const BuddyMemory &rhs) = delete;
+
+    const char* name(){ return "buddy"; }
+
+    void setupMemory(const unsigned int &mem){
+       size_ = mem;
+       free_ = mem;
+       unsigned long long start = 0;
+       for (int order = MAX_ORDER; order >= 0; order--){
+        if (mem & (1ULL << order)){
+            addFree(start, order);
+            start += 1ULL << order;
+        }
+       }
+    }
+
+    // Allocates the smallest power of 2 block that fits the process,
+    // splitting a larger free block if there is none of that size.
+    bool allocate(PCB* owner){
+       unsigned int byte = owner->getMemorySize();
+       int order = orderOf(byte);
+       //the free orders at or above the one needed
+       unsigned long long candidates = order > MAX_ORDER ? 0 : orders_ & (~0ULL << order);
+       if (candidates == 0){
+           //no memory available
+           return false;
+       }
+       take(owner, order);
+       internal_ += (1ULL << order) - byte;
+       return true;
+    }
+
+    // Frees the block of a process and coalesces it with its free buddies.
+    void deallocate(PCB* owner){
+       auto found = resident_.find(owner);
+       if (found == resident_.end()){
+           return;
+       }
+       unsigned long long start = found->second.first;
+       int order = found->second.second;
+       resident_.erase(found);
+       allocated_.erase(start);
+       blocks_[order]--;
+       free_ += 1ULL << order;
+       internal_ -= (1ULL << order) - owner->getMemorySize();
+       while (order < MAX_ORDER){
+           unsigned long long buddy = start ^ (1ULL << order);
+           if (buddy + (1ULL << order) > size_ || free_lists_[order].count(buddy) == 0){
+               break;
+           }
+           removeFree(buddy, order);
+           start = min(start, buddy);
+           order++;
+       }
+       addFree(start, order);
+    }
+
+    unsigned long long getFreeBytes(){
+       return free_;
+    }
+
+    unsigned int getLargestHole(){
+       return orders_ == 0 ? 0 : 1u << (63 - __builtin_clzll(orders_));
+    }
+
+    unsigned long long getInternalFragmentation(){
+       return internal_;
+    }
+
+    // Packs the blocks of the processes from the lowest address, largest
+    // first, so the free memory is left in the fewest blocks.
+    unsigned long long compact(){
+       vector<tuple<int, unsigned long long, PCB*>> blocks;
+       for (auto &block: allocated_){
+        //largest first, then by address
+        blocks.push_back(make_tuple(-block.second.first, block.first, block.second.second));
+       }
+       sort(blocks.begin(), blocks.end());
+       for (auto &list: free_lists_){
+        list.clear();
+       }
+       orders_ = 0;
+       allocated_.clear();
+       resident_.clear();
+       fill(blocks_, blocks_ + MAX_ORDER + 1, 0);
+       setupMemory(size_);
+       unsigned long long moved = 0;
+       for (auto &block: blocks){
+        PCB* owner = get<2>(block);
+        if (take(owner, -get<0>(block)) != get<1>(block)){
+            moved += owner->getMemorySize();
+        }
+       }
+       return moved;
+    }
+
+    // Replays compact() on the number of blocks of each order: the blocks,
+    // largest first, split the lowest order free block that fits, and the
+    // halves they do not use are what is left free.
+    unsigned long long getCompactedLargestHole(){
+       unsigned long long free[MAX_ORDER + 1] = {};
+       for (int order = 0; order <= MAX_ORDER; order++){
+        free[order] = (size_ >> order) & 1;
+       }
+       for (int order = MAX_ORDER; order >= 0; order--){
+        //the blocks still to place, in blocks of this order
+        unsigned long long need = blocks_[order];
+        for (int split = order; split <= MAX_ORDER && need > 0; split++){
+            unsigned long long units = 1ULL << (split - order);
+            unsigned long long used = min(free[split], need / units);
+            free[split] -= used;
+            need -= used * units;
+            if (need > 0 && need < units && free[split] > 0){
+                //the block is split down, and its halves past the last block stay free
+                free[split]--;
+                unsigned long long left = units - need;
+                for (int half = order; half < split; half++){
+                    free[half] += (left >> (half - order)) & 1;
+                }
+                need = 0;
+            }
+        }
+       }
+       for (int order = MAX_ORDER; order >= 0; order--){
+        if (free[order] > 0){
+            return 1ULL << order;
+        }
+       }
+       return 0;
+    }
+
+    void writeMemory(SnapshotWriter &out){
+       out << " ===================================\n";
+       out << "|       Random Access Memory        |\n";
+       out << " ===================================\n\n";
+       for (auto &block: blocks()){
+        unsigned long long start = get<0>(block);
+        unsigned long long bytes = 1ULL << get<1>(block);
+        PCB* owner = get<2>(block);
+        out << " -----------------------------------\n";
+        out << "\t" << start << " -> " << start + bytes - 1 << '\n';
+        out << " -----------------------------------\n\n";
+        if (owner == nullptr){
+            out << "\tEMPTY\n";
+        } else {
+            owner->writeProcessInfo(out);
+            out << "\tUnused >> " << bytes - owner->getMemorySize() << '\n';
+        }
+       }
+       out << "\n\tInternal fragmentation >> " << internal_ << " bytes\n";
+    }
+
+    void writeJSON(JSONSnapshot &fragments){
+       for (auto &block: blocks()){
+        SnapshotWriter &out = fragments.record();
+        out << "\"start\":" << get<0>(block) << ",\"bytes\":" << (1ULL << get<1>(block)) << ",\"pid\":";
+        if (get<2>(block) == nullptr){
+            out << "null";
+        } else {
+            out << get<2>(block)->getPID();
+        }
+        fragments.commit(get<0>(block));
+       }
+    }
+
+    string printPools(){
+       return "";
+    }
+
+    // Writes the free lists, and every allocated block as its start, order and PID.
+    void save(CheckpointWriter &out){
+       for (auto &list: free_lists_){
+        out.putVector(vector<unsigned long long>(list.begin(), list.end()));
+       }
+       out.put<unsigned long long>(allocated_.size());
+       for (auto &block: allocated_){
+        out.put(block.first);
+        out.put(block.second.first);
+        out.put(block.second.second->getPID());
+       }
+       out.put(internal_);
+    }
+
+    void load(CheckpointReader &in, ProcessTable &table){
+       free_ = 0;
+       orders_ = 0;
+       for (int order = 0; order <= MAX_ORDER; order++){
+        free_lists_[order].clear();
+        for (auto &start: in.getVector<unsigned long long>()){
+            addFree(start, order);
+            free_ += 1ULL << order;
+        }
+       }
+       allocated_.clear();
+       resident_.clear();
+       fill(blocks_, blocks_ + MAX_ORDER + 1, 0);
+       unsigned long long count = in.get<unsigned long long>();
+       for (unsigned long long i = 0; i < count && in.ok(); i++){
+        unsigned long long start = in.get<unsigned long long>();
+        int order = in.get<int>();
+        PCB* owner = table.getProcess(in.get<int>());
+        if (owner != nullptr){
+            allocated_[start] = make_pair(order, owner);
+            resident_[owner] = make_pair(start, order);
+            blocks_[order]++;
+        }
+       }
+       internal_ = in.get<unsigned long long>();
+    }
+
+private:
+    // 2^32 is above the largest memory size.
+    static const int MAX_ORDER = 32;
+
+    // The memory size in bytes.
+    unsigned long long size_ = 0;
+    // The bytes in free blocks.
+    unsigned long long free_ = 0;
+    // The bytes of the allocated blocks the processes did not ask for.
+    unsigned long long internal_ = 0;
+    // The start of every free block of 2^k bytes, in free_lists_[k].
+    set<unsigned long long> free_lists_[MAX_ORDER + 1];
+    // Bit k is set while free_lists_[k] is not empty.
+    unsigned long long orders_ = 0;
+    // The start and order of the block of each resident process.
+    unordered_map<PCB*, pair<unsigned long long, int>> resident_;
+    // The order and process of each allocated block, by start.
+    map<unsigned long long, pair<int, PCB*>> allocated_;
+    // The number of allocated blocks of 2^k bytes, in blocks_[k].
+    unsigned long long blocks_[MAX_ORDER + 1] = {};
+
+    // The smallest order of a block that holds bytes.
+    static int orderOf(const unsigned int &bytes){
+       return bytes <= 1 ? 0 : 64 - __builtin_clzll((unsigned long long)bytes - 1);
+    }
+
+    // Gives a process the lowest free block of the smallest order that fits,
+    // splitting it down to the order it needs. One must be free.
+    // return: The start of the block.
+    unsigned long long take(PCB* owner, const int &order){
+       int split = __builtin_ctzll(orders_ & (~0ULL << order));
+       unsigned long long start = *free_lists_[split].begin();
+       removeFree(start, split);
+       while (split > order){
+           split--;
+           //keep the lower half, free the upper one
+           addFree(start + (1ULL << split), split);
+       }
+       resident_[owner] = make_pair(start, order);
+       allocated_[start] = make_pair(order, owner);
+       blocks_[order]++;
+       free_ -= 1ULL << order;
+       return start;
+    }
+
+    void addFree(const unsigned long long &start, const int &order){
+       free_lists_[order].insert(start);
+       orders_ |= 1ULL << order;
+    }
+
+    void removeFree(const unsigned long long &start, const int &order){
+       free_lists_[order].erase(start);
+       if (free_lists_[order].empty()){
+           orders_ &= ~(1ULL << order);
+       }
+    }
+
+    // Gets every block, free (nullptr) or allocated, by start.
+    vector<tuple<unsigned long long, int, PCB*>> blocks(){
+       vector<tuple<unsigned long long, int, PCB*>> all;
+       for (int order = 0; order <= MAX_ORDER; order++){
+        for (auto &start: free_lists_[order]){
+            all.push_back(make_tuple(start, order, (PCB*)nullptr));
+        }
+       }
+       for (auto &block: allocated_){
+        all.push_back(make_tuple(block.first, block.second.first, block.second.second));
+       }
+       sort(all.begin(), all.end());
+       return all;
+    }
+};
+
+#endif
@@ -0,0 +1,273 @@
+/*
+  Title          : Checkpoint.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "CheckpointWriter" and "CheckpointReader" classes
+  Purpose        : Class project
+*/
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+/*
+Checkpoints::
+
+A checkpoint is the whole state of the System in one file, so a warmed up
+system can be restored in milliseconds and every experiment can branch
+from it instead of replaying the warmup trace.
+
+The System is a graph of PCB pointers: the CPU, the ready queue, the disk
+queues, the memory fragments and the frames all point at PCBs. A pointer
+means nothing in another run, so every reference to a process is written
+as its PID, and every other reference (a frame on the LRU list, a block of
+memory) as a number or an address. The file is position independent.
+
+Every component writes its fields as fixed-size native values one after
+the other, in a fixed order, and reads them back in the same order. A
+struct is written whole only if it has no padding, whose bytes are never
+initialised; any other is written field by field. The file is a header
+followed by those values:
+
+  magic    "OSCKPT05"
+  order    0x01020304, to refuse a file written with another byte order
+  size     the bytes after the header
+  checksum FNV-1a of the bytes after the header
+
+A restore maps the file into memory and copies the values straight out of
+it; there is nothing to parse. The checksum is verified before the System
+is touched, so a truncated or corrupted file is refused as a whole.
+*/
+// The header and checksum shared by the writer and the reader.
+class CheckpointFormat{
+protected:
+    static const unsigned int BYTE_ORDER_MARK = 0x01020304;
+
+    struct Header{
+        char magic_[8];
+        unsigned int order_;
+        unsigned int reserved_ = 0;
+        unsigned long long size_;
+        unsigned long long checksum_;
+    };
+
+    static const char* magic(){
+        return "OSCKPT05";
+    }
+
+    static unsigned long long checksum(const char* data, const size_t &size){
+        unsigned long long hash = 14695981039346656037ULL;
+        for (size_t i = 0; i < size; i++){
+            hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+
+class CheckpointWriter : private CheckpointFormat{
+public:
+    CheckpointWriter() = default;
+    CheckpointWriter(const CheckpointWriter &rhs) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter &rhs) = delete;
+
+    // Appends a value: a number, or a struct without padding.
+    template <class T>
+    void put(const T &value){
+        static_assert(is_trivially_copyable<T>::value, "checkpoints hold plain values only");
+        payload_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // Appends a string, as its length and its characters.
+    void putString(const string &text){
+        put<unsigned int>(text.size());
+        payload_.append(text);
+    }
+
+    // Appends an array of values, as its length and its values.
+    template <class T>
+    void putArray(const T* values, const size_t &count){
+        static_assert(is_trivially_copyable<T>::value, "checkpoints hold plain values only");
+        put<unsigned long long>(count);
+        payload_.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+    }
+
+    template <class T>
+    void putVector(const vector<T> &values){
+        putArray(values.data(), values.size());
+    }
+
+    // Writes the header and everything appended to a file. The file is
+    // written beside the target and renamed over it, so a crash, or a run
+    // restoring from the target, never sees it half written.
+    // return: False if the file could not be written. Otherwise true.
+    bool save(const string &path){
+        string temporary = path + ".tmp";
+        FILE* out = fopen(temporary.c_str(), "wb");
+        if (out == nullptr){
+            return false;
+        }
+        Header header;
+        memcpy(header.magic_, magic(), sizeof(header.magic_));
+        header.order_ = BYTE_ORDER_MARK;
+        header.size_ = payload_.size();
+        header.checksum_ = checksum(payload_.data(), payload_.size());
+        bool written = fwrite(&header, sizeof(header), 1, out) == 1
+                       && fwrite(payload_.data(), 1, payload_.size(), out) == payload_.size();
+        written = fclose(out) == 0 && written && rename(temporary.c_str(), path.c_str()) == 0;
+        if (!written){
+            remove(temporary.c_str());
+        }
+        return written;
+    }
+
+    // Gets the bytes appended so far.
+    size_t size(){
+        return payload_.size();
+    }
+
+private:
+    string payload_;
+};
+
+// Reads a checkpoint back from a memory-mapped file. Reading past the end
+// of the file gives zeros and marks the reader as failed.
+class CheckpointReader : private CheckpointFormat{
+public:
+    CheckpointReader() = default;
+    CheckpointReader(const CheckpointReader &rhs) = delete;
+    CheckpointReader& operator=(const CheckpointReader &rhs) = delete;
+
+    ~CheckpointReader(){
+        if (map_ != nullptr){
+            munmap(map_, length_);
+        }
+    }
+
+    // Maps a checkpoint file and verifies its header and checksum.
+    // param error: Set to the reason when the file cannot be used.
+    // return: True if the checkpoint can be read. Otherwise false.
+    bool open(const string &path, string &error){
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0){
+            error = "Cannot open checkpoint " + path;
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(Header)){
+            ::close(fd);
+            error = path + " is not a checkpoint";
+            return false;
+        }
+        length_ = info.st_size;
+        void* map = mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED){
+            error = "Cannot map checkpoint " + path;
+            return false;
+        }
+        map_ = map;
+        Header header;
+        memcpy(&header, map_, sizeof(header));
+        if (memcmp(header.magic_, magic(), sizeof(header.magic_)) != 0 || header.order_ != BYTE_ORDER_MARK){
+            error = path + " is not a checkpoint of this simulator";
+            return false;
+        }
+        data_ = static_cast<const char*>(map_) + sizeof(Header);
+        end_ = data_ + (length_ - sizeof(Header));
+        if (header.size_ != (unsigned long long)(end_ - data_) || header.checksum_ != checksum(data_, end_ - data_)){
+            error = "Checkpoint " + path + " is truncated or corrupted";
+            return false;
+        }
+        return true;
+    }
+
+    template <class T>
+    T get(){
+        static_assert(is_trivially_copyable<T>::value, "checkpoints hold plain values only");
+        T value = T();
+        take(&value, sizeof(T));
+        return value;
+    }
+
+    string getString(){
+        unsigned int size = get<unsigned int>();
+        if (!fits(size)){
+            return string();
+        }
+        string text(data_, size);
+        data_ += size;
+        return text;
+    }
+
+    template <class T>
+    vector<T> getVector(){
+        unsigned long long count = get<unsigned long long>();
+        if (count > (unsigned long long)(end_ - data_) / sizeof(T)){
+            failed_ = true;
+            return vector<T>();
+        }
+        vector<T> values(count);
+        take(values.data(), count * sizeof(T));
+        return values;
+    }
+
+    // Reads an array of a known length into place.
+    // return: False if the array in the file has another length.
+    template <class T>
+    bool getArray(T* values, const size_t &count){
+        if (get<unsigned long long>() != count){
+            failed_ = true;
+            return false;
+        }
+        return take(values, count * sizeof(T));
+    }
+
+    // Checks that nothing was read past the end of the file.
+    bool ok(){
+        return !failed_;
+    }
+
+    // Marks the reader as failed, when a value read does not fit the system.
+    void fail(){
+        failed_ = true;
+    }
+
+private:
+    void* map_ = nullptr;
+    size_t length_ = 0;
+    const char* data_ = nullptr;
+    const char* end_ = nullptr;
+    bool failed_ = false;
+
+    bool fits(const unsigned long long &size){
+        if (failed_ || size > (unsigned long long)(end_ - data_)){
+            failed_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool take(void* value, const size_t &size){
+        if (!fits(size)){
+            return false;
+        } else if (size == 0){
+            return true;
+        }
+        memcpy(value, data_, size);
+        data_ += size;
+        return true;
+    }
+};
+
+#endif
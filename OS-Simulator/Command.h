@@ -0,0 +1,245 @@
+/*
+  Title          : Command.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "CommandParser" class
+  Purpose        : Class project
+*/
+#ifndef __COMMAND_H__
+#define __COMMAND_H__
+
+#include <cstring>
+#include <limits>
+#include <string>
+
+using namespace std;
+
+/*
+Command parsing::
+
+A command is a letter and its fields, separated by any number of spaces or
+tabs. The parser never copies the line: a field is a token, a pointer into
+the line and a length, and a number is read from its digits in place, so a
+trace can be parsed straight out of the file mapped in memory. Each number
+is checked against the type of its field: a digit too many is an error, not
+a value cut down to fit. What a command means (is there such a disk?) is up
+to the System; the parser only tells whether the line is well formed, and
+if not, which field is wrong.
+*/
+
+// A field of a command: where it starts in the line, and its length.
+struct Token{
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+
+    bool empty() const{
+        return size_ == 0;
+    }
+
+    bool operator==(const char* text) const{
+        return strlen(text) == size_ && memcmp(data_, text, size_) == 0;
+    }
+
+    string str() const{
+        return string(data_, size_);
+    }
+};
+
+// A command of the console or of a trace, with its fields parsed.
+struct Command{
+    // Not a command: an empty line, or a comment.
+    static const char NONE = 0;
+    // "commands", the manual.
+    static const char HELP = '?';
+
+    // The letter of the command.
+    char op_ = NONE;
+    // A: the priority and memory of the process, its burst and deadline in
+    // quanta (0 for none), and the only core it may run on (-1 for any).
+    int priority_ = 0;
+    unsigned int memory_ = 0;
+    unsigned long long burst_ = 0;
+    unsigned long long deadline_ = 0;
+    // A: the core of the process. c: the core to switch to.
+    int core_ = -1;
+    // d, D: the disk. d: the file, and the cylinder it is on.
+    int disk_ = 0;
+    Token file_;
+    unsigned int cylinder_ = 0;
+    // m: the logical address.
+    unsigned long long address_ = 0;
+    // S: the snapshot, and its format: ' ' for text, j for JSON lines, d for the JSON delta.
+    char snapshot_ = 0;
+    char format_ = ' ';
+    // C, R: the checkpoint file.
+    Token path_;
+};
+
+class CommandParser{
+public:
+    // param begin: The first character of the line.
+    // param end: Past the last character of the line, without its terminator.
+    CommandParser(const char* begin, const char* end) : pos_{begin}, end_{end}{}
+
+    // Parses the line. An empty line or a comment ('#') is the command NONE.
+    // param command: Set to the command.
+    // param error: Set to what is wrong with the line.
+    // return: False if the line is not a valid command. Otherwise true.
+    bool parse(Command &command, string &error){
+        command = Command();
+        Token op;
+        if (!next(op) || op.data_[0] == '#'){
+            return true;
+        }
+        if (op == "commands"){
+            command.op_ = Command::HELP;
+            return rest(error);
+        }
+        if (op.size_ != 1 || strchr("AdDStmQCRcq", op.data_[0]) == nullptr){
+            error = "Invalid command " + op.str();
+            return false;
+        }
+        command.op_ = op.data_[0];
+        switch (command.op_){
+        case 'A':
+            if (!number("priority", command.priority_, true, error)
+                || !number("memory size", command.memory_, true, error)
+                || !number("burst", command.burst_, false, error)
+                || !number("deadline", command.deadline_, false, error)
+                || !number("core", command.core_, false, error)){
+                return false;
+            }
+            break;
+        case 'd':
+            if (!number("disk", command.disk_, true, error)){
+                return false;
+            }
+            if (next(command.file_) && !number("cylinder", command.cylinder_, false, error)){
+                return false;
+            }
+            break;
+        case 'D':
+            if (!number("disk", command.disk_, true, error)){
+                return false;
+            }
+            break;
+        case 'm':
+            if (!number("memory address", command.address_, true, error)){
+                return false;
+            }
+            break;
+        case 'S':
+            if (!letter("snapshot", command.snapshot_, true, error)
+                || !letter("snapshot format", command.format_, false, error)){
+                return false;
+            }
+            break;
+        case 'C':
+        case 'R':
+            if (!next(command.path_)){
+                error = "Missing checkpoint file";
+                return false;
+            }
+            break;
+        case 'c':
+            if (!number("core", command.core_, true, error)){
+                return false;
+            }
+            break;
+        }
+        return rest(error);
+    }
+
+private:
+    const char* pos_;
+    const char* end_;
+
+    static bool isSpace(const char &c){
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    // Gets the next field.
+    // return: False if there is none left. Otherwise true.
+    bool next(Token &token){
+        while (pos_ != end_ && isSpace(*pos_)){
+            pos_++;
+        }
+        if (pos_ == end_){
+            return false;
+        }
+        token.data_ = pos_;
+        while (pos_ != end_ && !isSpace(*pos_)){
+            pos_++;
+        }
+        token.size_ = pos_ - token.data_;
+        return true;
+    }
+
+    // Reads the next field as a decimal number that fits T; only a signed T takes a '-'.
+    // param name: The field, for the error.
+    // param value: Set to the number; left alone if the field is optional and missing.
+    // param required: Whether a missing field is an error.
+    // return: False if the field is missing and required, or not a number of its type.
+    template <typename T>
+    bool number(const char* name, T &value, const bool &required, string &error){
+        Token token;
+        if (!next(token)){
+            if (required){
+                error = string("Missing ") + name;
+            }
+            return !required;
+        }
+        const char* digit = token.data_;
+        const char* last = token.data_ + token.size_;
+        bool negative = numeric_limits<T>::is_signed && *digit == '-';
+        if (negative){
+            digit++;
+        }
+        //the magnitude of the most negative T is one more than its max
+        unsigned long long limit = (unsigned long long)numeric_limits<T>::max() + (negative ? 1 : 0);
+        unsigned long long magnitude = 0;
+        if (digit == last){
+            error = string("Invalid ") + name + " " + token.str();
+            return false;
+        }
+        for (; digit != last; digit++){
+            unsigned int d = *digit - '0';
+            if (d > 9 || magnitude > (limit - d) / 10){
+                error = string("Invalid ") + name + " " + token.str();
+                return false;
+            }
+            magnitude = magnitude * 10 + d;
+        }
+        value = negative ? (T)(0 - magnitude) : (T)magnitude;
+        return true;
+    }
+
+    // Reads the next field as a single character.
+    bool letter(const char* name, char &value, const bool &required, string &error){
+        Token token;
+        if (!next(token)){
+            if (required){
+                error = string("Missing ") + name;
+            }
+            return !required;
+        }
+        if (token.size_ != 1){
+            error = string("Invalid ") + name + " " + token.str();
+            return false;
+        }
+        value = token.data_[0];
+        return true;
+    }
+
+    // Checks that nothing follows the last field.
+    bool rest(string &error){
+        Token token;
+        if (next(token)){
+            error = "Unexpected " + token.str();
+            return false;
+        }
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,288 @@
+/*
+  Title          : DiskWorkers.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "DiskWorkers" class
+  Purpose        : Class project
+*/
+#ifndef __DISK_WORKERS_H__
+#define __DISK_WORKERS_H__
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/*
+Device threads::
+
+In threaded mode every disk is served by its own thread, the way a device
+controller works beside the CPU. The scheduler (the only thread that touches
+the System) hands a request to a disk through that disk's single producer,
+single consumer ring. The disk waits out its service time and posts the
+finished request to a completion queue shared by every disk, which the
+scheduler drains between commands as its disk interrupts. A request is only
+its disk number: the disk queue of the System knows whose request the disk
+is serving, as it does when a 'D' command interrupts the disk.
+
+Neither queue takes a lock: each slot is handed between threads by one
+atomic index (the rings) or one atomic sequence number (the completion
+queue), stored with release and loaded with acquire ordering.
+
+An idle disk polls its ring, yielding, a few times, then sleeps between polls,
+doubling the sleep up to a fifth of a millisecond, so disks without requests
+leave the cores to the scheduler and to the disks that have work.
+*/
+
+// Pads an atomic index to its own cache line, so the producer and consumer
+// of a queue do not invalidate each other's line on every operation.
+struct PaddedIndex{
+    atomic<size_t> value_;
+    char pad_[64 - sizeof(atomic<size_t>)];
+
+    PaddedIndex() : value_{0}{}
+};
+
+// A bounded queue between exactly one producer and one consumer thread.
+template <class T>
+class SPSCRing{
+public:
+    // param capacity: The number of slots; must be a power of two.
+    explicit SPSCRing(const size_t capacity) : slots_(capacity), mask_{capacity - 1}{}
+
+    // Called by the producer only.
+    // return: False if the ring is full. Otherwise true.
+    bool push(const T &value){
+        size_t tail = tail_.value_.load(memory_order_relaxed);
+        if (tail - head_.value_.load(memory_order_acquire) == slots_.size()){
+            return false;
+        }
+        slots_[tail & mask_] = value;
+        tail_.value_.store(tail + 1, memory_order_release);
+        return true;
+    }
+
+    // Called by the consumer only.
+    // return: False if the ring is empty. Otherwise true.
+    bool pop(T &value){
+        size_t head = head_.value_.load(memory_order_relaxed);
+        if (head == tail_.value_.load(memory_order_acquire)){
+            return false;
+        }
+        value = slots_[head & mask_];
+        head_.value_.store(head + 1, memory_order_release);
+        return true;
+    }
+
+private:
+    PaddedIndex head_;
+    PaddedIndex tail_;
+    vector<T> slots_;
+    size_t mask_;
+};
+
+// A bounded queue between any number of producers and one consumer. Every
+// slot carries a sequence number telling whose turn it is: a producer may
+// fill slot i when its sequence is i, the consumer may empty it at i + 1.
+template <class T>
+class MPSCQueue{
+public:
+    // param capacity: The number of slots; must be a power of two.
+    explicit MPSCQueue(const size_t capacity) : cells_(new Cell[capacity]), mask_{capacity - 1}{
+        for (size_t i = 0; i < capacity; i++){
+            cells_[i].sequence_.store(i, memory_order_relaxed);
+        }
+    }
+
+    // Called by any producer.
+    // return: False if the queue is full. Otherwise true.
+    bool push(const T &value){
+        size_t tail = tail_.value_.load(memory_order_relaxed);
+        Cell* cell;
+        while (true){
+            cell = &cells_[tail & mask_];
+            size_t sequence = cell->sequence_.load(memory_order_acquire);
+            long long turn = (long long)sequence - (long long)tail;
+            if (turn == 0){
+                if (tail_.value_.compare_exchange_weak(tail, tail + 1, memory_order_relaxed)){
+                    break;
+                }
+            } else if (turn < 0){
+                return false;
+            } else {
+                tail = tail_.value_.load(memory_order_relaxed);
+            }
+        }
+        cell->value_ = value;
+        cell->sequence_.store(tail + 1, memory_order_release);
+        return true;
+    }
+
+    // Called by the consumer only.
+    // return: False if the queue is empty. Otherwise true.
+    bool pop(T &value){
+        Cell &cell = cells_[head_ & mask_];
+        if (cell.sequence_.load(memory_order_acquire) != head_ + 1){
+            return false;
+        }
+        value = cell.value_;
+        cell.sequence_.store(head_ + mask_ + 1, memory_order_release);
+        head_++;
+        return true;
+    }
+
+private:
+    struct Cell{
+        atomic<size_t> sequence_;
+        T value_;
+    };
+
+    unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    PaddedIndex tail_;
+    // Only the consumer reads or writes the head.
+    size_t head_ = 0;
+};
+
+// Waits between the empty polls of an idle thread: a yield for the first
+// few, then sleeps doubling from 1 to MAX_SLEEP_US microseconds.
+class IdleBackoff{
+public:
+    void wait(){
+        if (polls_ < YIELD_POLLS){
+            polls_++;
+            this_thread::yield();
+            return;
+        }
+        this_thread::sleep_for(chrono::microseconds(sleep_us_));
+        sleep_us_ = sleep_us_ * 2 < MAX_SLEEP_US ? sleep_us_ * 2 : MAX_SLEEP_US;
+    }
+
+    // Called once a poll comes back with work.
+    void reset(){
+        polls_ = 0;
+        sleep_us_ = 1;
+    }
+
+private:
+    static const unsigned int YIELD_POLLS = 16;
+    static const unsigned int MAX_SLEEP_US = 200;
+    unsigned int polls_ = 0;
+    unsigned int sleep_us_ = 1;
+};
+
+// A disk request, and later its completion.
+struct DiskRequest{
+    int disk_;
+};
+
+class DiskWorkers{
+public:
+    // Slots in every request ring and in the completion queue.
+    static const size_t RING_SIZE = 1024;
+
+    DiskWorkers() : completions_(RING_SIZE * 16){}
+    DiskWorkers(const DiskWorkers &rhs) = delete;
+    DiskWorkers& operator=(const DiskWorkers &rhs) = delete;
+
+    // Destructor; Stops every disk thread.
+    ~DiskWorkers(){ stop(); }
+
+    // Starts one thread per disk.
+    // param num_disks: The number of disks.
+    // param service_us: How long a disk takes to serve a request, in microseconds.
+    void start(const int &num_disks, const unsigned int &service_us){
+        stop();
+        service_ = chrono::microseconds(service_us);
+        running_.store(true);
+        for (int disk = 0; disk < num_disks; disk++){
+            rings_.push_back(unique_ptr<SPSCRing<DiskRequest>>(new SPSCRing<DiskRequest>(RING_SIZE)));
+        }
+        for (int disk = 0; disk < num_disks; disk++){
+            threads_.push_back(thread(&DiskWorkers::serve, this, disk));
+        }
+    }
+
+    // Stops and joins every disk thread. Poll every request first (see
+    // inFlight) to complete them; the ones still queued or not polled are dropped.
+    // return: The number of requests dropped.
+    size_t stop(){
+        size_t dropped = in_flight_;
+        running_.store(false);
+        for (auto &worker: threads_){
+            worker.join();
+        }
+        threads_.clear();
+        rings_.clear();
+        DiskRequest finished;
+        while (completions_.pop(finished)){}
+        in_flight_ = 0;
+        return dropped;
+    }
+
+    // Checks to see if the disks are served by threads.
+    bool isRunning(){
+        return !threads_.empty();
+    }
+
+    // Hands a request to its disk thread, waiting while its ring is full.
+    // param disk: The disk number.
+    void submit(const int &disk){
+        DiskRequest request{disk};
+        while (!rings_[disk]->push(request)){
+            this_thread::yield();
+        }
+        in_flight_++;
+    }
+
+    // Gets a finished request, if any.
+    // param done: Set to the finished request.
+    // return: False if no request has finished. Otherwise true.
+    bool poll(DiskRequest &done){
+        if (!completions_.pop(done)){
+            return false;
+        }
+        in_flight_--;
+        return true;
+    }
+
+    // Gets the number of requests submitted and not yet polled.
+    size_t inFlight(){
+        return in_flight_;
+    }
+
+private:
+    vector<unique_ptr<SPSCRing<DiskRequest>>> rings_;
+    MPSCQueue<DiskRequest> completions_;
+    vector<thread> threads_;
+    atomic<bool> running_{false};
+    chrono::microseconds service_{0};
+    // Only the scheduler thread reads or writes this.
+    size_t in_flight_ = 0;
+
+    // The loop of a disk thread.
+    // param disk: The disk the thread serves.
+    void serve(const int disk){
+        SPSCRing<DiskRequest> &ring = *rings_[disk];
+        DiskRequest request;
+        IdleBackoff idle;
+        while (running_.load(memory_order_relaxed)){
+            if (!ring.pop(request)){
+                idle.wait();
+                continue;
+            }
+            idle.reset();
+            if (service_.count() > 0){
+                this_thread::sleep_for(service_);
+            }
+            while (!completions_.push(request) && running_.load(memory_order_relaxed)){
+                this_thread::yield();
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,421 @@
+/*
+  Title          : EventEngine.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "EventEngine" class
+  Purpose        : Class project
+*/
+#ifndef __EVENT_ENGINE_H__
+#define __EVENT_ENGINE_H__
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Memory.h"
+#include "Pool.h"
+#include "Workload.h"
+using namespace std;
+
+/*
+Discrete-event simulation::
+
+Commands only move the simulation when someone types them. The engine keeps
+a virtual clock instead, and a queue of pending events ordered by the time
+they happen. It repeatedly takes the earliest event, moves the clock to it,
+and drives the System through the same calls the commands make:
+
+  ARRIVAL         a new process is created ('A').
+  QUANTUM_EXPIRY  the process in CPU spent a time quantum ('Q').
+  IO_REQUEST      the process in CPU asks for a disk ('d').
+  IO_COMPLETION   a disk finished the request at its head ('D').
+  TERMINATION     the process in CPU finished its CPU burst ('t').
+
+Nothing happens between two events, so the clock jumps straight from one to
+the next and hours of simulated load take seconds of real time. Every time is
+in simulated microseconds, and every time and size is drawn from the workload
+(see Workload.h).
+
+With several cores, every core runs its own time slices; a CPU event carries
+its core, and the engine selects that core before driving the System.
+
+The pending events are kept in a pairing heap: inserting is O(1) and taking
+the earliest event is O(log n) amortized. When the process in CPU changes,
+its pending CPU event is not removed from the heap; it carries the number of
+the time slice it was made for and is skipped if that slice is over.
+*/
+
+enum EventType : unsigned char { ARRIVAL, QUANTUM_EXPIRY, IO_REQUEST, IO_COMPLETION, TERMINATION };
+
+struct Event{
+    unsigned long long time_;
+    // Breaks ties between events at the same time in the order they were made.
+    unsigned long long sequence_;
+    EventType type_;
+    // The core of a CPU event.
+    unsigned short core_;
+    // The disk of an IO_COMPLETION, or the time slice of a CPU event.
+    unsigned long long target_;
+};
+
+// A min-heap of events, as a pairing heap: a tree whose root is the earliest
+// event, where each node keeps its children in a sibling list.
+class EventQueue{
+public:
+    EventQueue() = default;
+    EventQueue(const EventQueue &rhs) = delete;
+    EventQueue& operator=(const EventQueue &rhs) = delete;
+
+    bool empty(){
+        return root_ == nullptr;
+    }
+
+    size_t size(){
+        return size_;
+    }
+
+    // Adds an event; O(1).
+    void push(const Event &event){
+        root_ = meld(root_, nodes_.acquire(event));
+        size_++;
+    }
+
+    // Removes the earliest event; O(log n) amortized.
+    // return: The earliest event. The queue must not be empty.
+    Event pop(){
+        Node* old_root = root_;
+        Event event = old_root->event_;
+        root_ = mergePairs(old_root->child_);
+        nodes_.release(old_root);
+        size_--;
+        return event;
+    }
+
+private:
+    struct Node{
+        Event event_;
+        Node* child_ = nullptr;
+        Node* sibling_ = nullptr;
+
+        explicit Node(const Event &event) : event_(event){}
+    };
+
+    ObjectPool<Node> nodes_;
+    Node* root_ = nullptr;
+    size_t size_ = 0;
+
+    static bool earlier(const Node* lhs, const Node* rhs){
+        if (lhs->event_.time_ != rhs->event_.time_){
+            return lhs->event_.time_ < rhs->event_.time_;
+        }
+        return lhs->event_.sequence_ < rhs->event_.sequence_;
+    }
+
+    // Makes the later root the first child of the earlier one.
+    static Node* meld(Node* lhs, Node* rhs){
+        if (lhs == nullptr){
+            return rhs;
+        }
+        if (rhs == nullptr){
+            return lhs;
+        }
+        if (earlier(rhs, lhs)){
+            swap(lhs, rhs);
+        }
+        rhs->sibling_ = lhs->child_;
+        lhs->child_ = rhs;
+        return lhs;
+    }
+
+    // Melds the children of a removed root in two passes: pairs from left to
+    // right, then the pairs from right to left. Iterative, so a long sibling
+    // list cannot overflow the stack.
+    static Node* mergePairs(Node* first){
+        Node* pairs = nullptr;
+        while (first != nullptr){
+            Node* second = first->sibling_;
+            Node* next = second == nullptr ? nullptr : second->sibling_;
+            first->sibling_ = nullptr;
+            if (second != nullptr){
+                second->sibling_ = nullptr;
+            }
+            Node* pair = meld(first, second);
+            //push the pair on a reversed list for the second pass
+            pair->sibling_ = pairs;
+            pairs = pair;
+            first = next;
+        }
+        Node* root = nullptr;
+        while (pairs != nullptr){
+            Node* next = pairs->sibling_;
+            pairs->sibling_ = nullptr;
+            root = meld(root, pairs);
+            pairs = next;
+        }
+        return root;
+    }
+};
+
+class EventEngine{
+public:
+    // param system: The system to drive; its memory and disks must be set up.
+    // param num_disks: The number of disks in the system.
+    // param config: The workload.
+    EventEngine(System &system, const int &num_disks, const SimulationConfig &config)
+        : system_(system), config_(config),
+          workload_(config, system.getPriorityLevels(), num_disks, system.getCylinders()),
+          running_(system.getCores(), 0), slice_(system.getCores(), 0), slice_start_(system.getCores(), 0),
+          disk_queued_(num_disks, 0), disk_started_(num_disks, 0), disk_busy_(num_disks, 0){}
+    EventEngine(const EventEngine &rhs) = delete;
+    EventEngine& operator=(const EventEngine &rhs) = delete;
+
+    // Runs the simulation until the clock passes the configured duration.
+    // param pid_tracker: The current available ID for the process.
+    // return: The number of events handled.
+    unsigned long long run(int &pid_tracker){
+        schedule(workload_.nextArrival(), ARRIVAL, 0);
+        while (!events_.empty()){
+            Event event = events_.pop();
+            if (event.time_ > config_.duration_){
+                break;
+            }
+            if (isCPUEvent(event.type_) && event.target_ != slice_[event.core_]){
+                continue;
+            }
+            advance(event.time_);
+            handle(event, pid_tracker);
+            dispatch();
+            handled_++;
+        }
+        advance(config_.duration_);
+        return handled_;
+    }
+
+    // Gets the time-based statistics of the run.
+    // return: A string of the statistics.
+    string printStatistics(){
+        double seconds = clock_ / 1e6;
+        stringstream ss;
+        ss << " ===================================\n";
+        ss << "|     S I M U L A T I O N           |\n";
+        ss << " ===================================\n\n";
+        ss << "\tSimulated time: " << seconds << " s\n";
+        ss << "\tEvents: " << handled_ << "\n";
+        ss << "\tArrivals: " << arrived_ << " (" << rejected_ << " rejected, no memory)\n";
+        ss << "\tCompleted: " << completed_ << " (" << (seconds > 0 ? completed_ / seconds : 0) << " per s)\n";
+        ss << "\tMean turnaround: " << (completed_ > 0 ? turnaround_ / completed_ / 1e3 : 0) << " ms\n";
+        ss << "\tMean quanta: " << (completed_ > 0 ? quanta_ / completed_ : 0) << "\n";
+        ss << "\tCPU utilization: " << percent(cpu_busy_) / running_.size() << "%\n";
+        ss << "\tMean processes in system: " << average(in_system_area_) << "\n";
+        ss << "\tMean processes ready: " << average(ready_area_) << "\n";
+        for (size_t disk = 0; disk < disk_busy_.size(); disk++){
+            ss << "\tDisk " << disk << " utilization: " << percent(disk_busy_[disk]) << "%, seek "
+               << system_.getDiskTotalSeek(disk) << " cylinders\n";
+        }
+        return ss.str();
+    }
+
+private:
+    // What the engine knows about a process; the System knows the rest.
+    struct Job{
+        unsigned long long arrival_ = 0;
+        unsigned long long remaining_ = 0;
+        unsigned long long until_io_ = 0;
+    };
+
+    System &system_;
+    SimulationConfig config_;
+    Workload workload_;
+    EventQueue events_;
+    unsigned long long clock_ = 0;
+    unsigned long long sequence_ = 0;
+    // Every process the engine created, by PID.
+    vector<Job> jobs_;
+    // By core: the process in CPU, the time slice it is in, and when the slice started.
+    vector<int> running_;
+    vector<unsigned long long> slice_;
+    vector<unsigned long long> slice_start_;
+    // The time slices started so far, on every core; numbers the next one.
+    unsigned long long slices_ = 0;
+    // The cores running a process.
+    int busy_ = 0;
+    // Requests waiting for or being served by each disk, and when the
+    // request being served started.
+    vector<int> disk_queued_;
+    vector<unsigned long long> disk_started_;
+    int in_system_ = 0;
+    int waiting_ = 0;
+
+    // Statistics.
+    unsigned long long handled_ = 0;
+    unsigned long long arrived_ = 0;
+    unsigned long long rejected_ = 0;
+    unsigned long long completed_ = 0;
+    double turnaround_ = 0;
+    double quanta_ = 0;
+    unsigned long long cpu_busy_ = 0;
+    vector<unsigned long long> disk_busy_;
+    // Number of processes integrated over time, for time averages.
+    double in_system_area_ = 0;
+    double ready_area_ = 0;
+
+    static bool isCPUEvent(const EventType &type){
+        return type == QUANTUM_EXPIRY || type == IO_REQUEST || type == TERMINATION;
+    }
+
+    void schedule(const unsigned long long &delay, const EventType &type, const unsigned long long &target,
+                  const int &core = 0){
+        events_.push(Event{clock_ + delay, sequence_++, type, (unsigned short)core, target});
+    }
+
+    // Moves the clock to a later time, charging the time passed to the
+    // process in CPU and to the time averages.
+    void advance(const unsigned long long &time){
+        unsigned long long passed = time - clock_;
+        system_.setClock(time);
+        cpu_busy_ += passed * busy_;
+        in_system_area_ += (double)in_system_ * passed;
+        ready_area_ += (double)(in_system_ - waiting_ - busy_) * passed;
+        clock_ = time;
+    }
+
+    void handle(const Event &event, int &pid_tracker){
+        if (isCPUEvent(event.type_)){
+            //the slice ran to its end
+            int core = event.core_;
+            Job &job = jobs_[running_[core]];
+            unsigned long long ran = clock_ - slice_start_[core];
+            job.remaining_ -= ran;
+            job.until_io_ -= ran;
+            running_[core] = 0;
+            busy_--;
+            system_.selectCore(core);
+        }
+        switch (event.type_){
+        case ARRIVAL:
+            arrive(pid_tracker);
+            schedule(workload_.nextArrival(), ARRIVAL, 0);
+            break;
+        case QUANTUM_EXPIRY:
+            system_.expireQuantum();
+            break;
+        case IO_REQUEST:
+            requestDisk();
+            break;
+        case IO_COMPLETION:
+            disk_busy_[event.target_] += clock_ - disk_started_[event.target_];
+            disk_queued_[event.target_]--;
+            waiting_--;
+            system_.interruptDisk((int)event.target_);
+            if (disk_queued_[event.target_] > 0){
+                serveDisk(event.target_);
+            }
+            break;
+        case TERMINATION:
+            completed_++;
+            in_system_--;
+            turnaround_ += clock_ - jobs_[system_.getCPUprocess()->getPID()].arrival_;
+            quanta_ += system_.getCPUprocess()->getQuanta();
+            system_.terminate();
+            break;
+        }
+    }
+
+    void arrive(int &pid_tracker){
+        arrived_++;
+        int pid = pid_tracker;
+        int priority = workload_.priority();
+        if (!system_.newProcess(priority, workload_.memory(), pid_tracker)){
+            rejected_++;
+            return;
+        }
+        if ((size_t)pid >= jobs_.size()){
+            jobs_.resize(pid + 1);
+        }
+        Job &job = jobs_[pid];
+        job.arrival_ = clock_;
+        job.remaining_ = workload_.burst();
+        job.until_io_ = workload_.ioInterval();
+        in_system_++;
+    }
+
+    void requestDisk(){
+        Job &job = jobs_[system_.getCPUprocess()->getPID()];
+        job.until_io_ = workload_.ioInterval();
+        int disk = workload_.disk();
+        unsigned int cylinder = workload_.cylinder();
+        system_.requestIO(disk, "", cylinder);
+        waiting_++;
+        if (++disk_queued_[disk] == 1){
+            serveDisk(disk);
+        }
+    }
+
+    // Starts serving the request the disk picked; the head moves to it first.
+    void serveDisk(const unsigned long long &disk){
+        disk_started_[disk] = clock_;
+        unsigned long long seek = config_.seek_us_ * system_.getDiskLastSeek(disk);
+        schedule(seek + workload_.diskService(), IO_COMPLETION, disk);
+    }
+
+    // Starts a new time slice on every core whose process in CPU changed, or
+    // whose slice just ended; the slice ends at the first of its quantum, its
+    // next disk request, or the end of its burst.
+    void dispatch(){
+        //every slice that ends is charged before a process starts on another core
+        unsigned long long changed = 0;
+        for (int core = 0; core < (int)running_.size(); core++){
+            if (runningOn(core) == running_[core]){
+                continue;
+            }
+            changed |= 1ULL << core;
+            if (running_[core] != 0){
+                //preempted before its slice ended
+                Job &job = jobs_[running_[core]];
+                unsigned long long ran = clock_ - slice_start_[core];
+                job.remaining_ -= ran;
+                job.until_io_ -= ran;
+                busy_--;
+            }
+        }
+        for (; changed != 0; changed &= changed - 1){
+            startSlice(__builtin_ctzll(changed));
+        }
+    }
+
+    int runningOn(const int &core){
+        PCB* cpu = system_.getCPUprocess(core);
+        return cpu == nullptr ? 0 : cpu->getPID();
+    }
+
+    void startSlice(const int &core){
+        int pid = runningOn(core);
+        running_[core] = pid;
+        slice_[core] = ++slices_;
+        slice_start_[core] = clock_;
+        if (pid == 0){
+            return;
+        }
+        busy_++;
+        Job &job = jobs_[pid];
+        unsigned long long quantum = workload_.quantum();
+        if (job.remaining_ <= quantum && job.remaining_ <= job.until_io_){
+            schedule(job.remaining_, TERMINATION, slice_[core], core);
+        } else if (job.until_io_ <= quantum){
+            schedule(job.until_io_, IO_REQUEST, slice_[core], core);
+        } else {
+            schedule(quantum, QUANTUM_EXPIRY, slice_[core], core);
+        }
+    }
+
+    double percent(const unsigned long long &busy){
+        return clock_ > 0 ? 100.0 * busy / clock_ : 0;
+    }
+
+    double average(const double &area){
+        return clock_ > 0 ? area / clock_ : 0;
+    }
+};
+
+#endif
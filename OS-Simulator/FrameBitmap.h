@@ -0,0 +1,292 @@
+/*
+  Title          : FrameBitmap.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "FrameBitmap" class
+  Purpose        : Class project
+*/
+#ifndef __FRAME_BITMAP_H__
+#define __FRAME_BITMAP_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/*
+Bit vector::
+
+Frequently, the free-space list is implemented as a bit map or bit vector.
+Each frame is represented by 1 bit. If the frame is free, the bit is 1; if
+the frame is allocated, the bit is 0. A RAM of 4,000,000,000 bytes in frames
+of 4096 bytes needs 122 KB of bits, and only for the frames that were ever
+handed out.
+
+The first free frame is the first bit set in the first word that is not 0,
+so the search is a scan for a word that is not 0. A second level, the
+summary, has a bit for every word of the bitmap, set while that word has a
+free frame: the scan reads one summary word for every 4096 frames, and the
+summary word it stops at points to the word holding the frame. Every summary
+word before the first free frame is 0, and stays 0 until a frame below it is
+released, so the scan starts where the last one stopped.
+
+A run of N contiguous free frames is found the same way: the empty words
+between runs are skipped through the summary, and the full words inside a
+run are skipped without looking at their bits. A run inside one word is
+found with all its starts at once: and-ing the word with itself shifted by
+1, 2, 4, ... frames leaves a bit set where N free frames start. Both scans compare 4 words at
+a time with AVX2, or 2 with SSE2, whichever the processor has, and one at a
+time otherwise.
+*/
+class FrameBitmap{
+public:
+    // Returned when no frame (or run of frames) is free.
+    static const unsigned int NONE = 0xFFFFFFFFu;
+
+    // How the words are scanned.
+    enum Scan : unsigned char { SCALAR, SSE2, AVX2 };
+
+    // Default constructor/destructor.
+    FrameBitmap() = default;
+    ~FrameBitmap() = default;
+
+    // Gets the widest scan the processor has.
+    static Scan bestScan(){
+#if defined(__x86_64__) || defined(__i386__)
+        if (__builtin_cpu_supports("avx2")){
+            return AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")){
+            return SSE2;
+        }
+#endif
+        return SCALAR;
+    }
+
+    // Sets how the words are scanned; the scan must be one the processor has.
+    void setScan(const Scan &scan){
+        scan_ = scan;
+    }
+
+    // Removes every frame.
+    void clear(){
+        leaves_.clear();
+        summary_.clear();
+        size_ = 0;
+        hint_ = 0;
+    }
+
+    // Gets the number of frames the bitmap covers.
+    unsigned int size(){
+        return size_;
+    }
+
+    // Covers more frames; the frames added are allocated.
+    // param size: The number of frames, not less than size().
+    void grow(const unsigned int &size){
+        size_ = size;
+        size_t words = ((size_t)size + 63) / 64;
+        leaves_.resize(words, 0);
+        summary_.resize((words + 63) / 64, 0);
+    }
+
+    // Tells whether a frame is free.
+    bool isFree(const unsigned int &frame){
+        return (leaves_[frame / 64] >> (frame % 64)) & 1;
+    }
+
+    // Marks a frame as free.
+    void release(const unsigned int &frame){
+        size_t word = frame / 64;
+        leaves_[word] |= 1ULL << (frame % 64);
+        summary_[word / 64] |= 1ULL << (word % 64);
+        if (word / 64 < hint_){
+            hint_ = word / 64;
+        }
+    }
+
+    // Marks a frame as allocated.
+    void take(const unsigned int &frame){
+        size_t word = frame / 64;
+        leaves_[word] &= ~(1ULL << (frame % 64));
+        if (leaves_[word] == 0){
+            summary_[word / 64] &= ~(1ULL << (word % 64));
+        }
+    }
+
+    // Marks a run of frames as allocated.
+    // param first: The first frame of the run.
+    // param count: The number of frames in the run.
+    void takeRun(const unsigned int &first, const unsigned int &count){
+        unsigned long long frame = first, end = (unsigned long long)first + count;
+        while (frame < end){
+            size_t word = frame / 64;
+            unsigned int bit = frame % 64;
+            unsigned long long bits = end - frame < 64 - bit ? end - frame : 64 - bit;
+            uint64_t mask = bits == 64 ? ~0ULL : ((1ULL << bits) - 1) << bit;
+            leaves_[word] &= ~mask;
+            if (leaves_[word] == 0){
+                summary_[word / 64] &= ~(1ULL << (word % 64));
+            }
+            frame += bits;
+        }
+    }
+
+    // Finds the lowest free frame.
+    // return: The frame number, or NONE if every frame is allocated.
+    unsigned int findFree(){
+        hint_ = firstNot(summary_.data(), hint_, summary_.size(), 0);
+        if (hint_ == summary_.size()){
+            return NONE;
+        }
+        size_t word = hint_ * 64 + __builtin_ctzll(summary_[hint_]);
+        return word * 64 + __builtin_ctzll(leaves_[word]);
+    }
+
+    // Finds the lowest run of contiguous free frames.
+    // param count: The number of frames in the run, at least 1.
+    // return: The first frame of the run, or NONE if there is no such run.
+    unsigned int findRun(const unsigned int &count){
+        size_t words = leaves_.size();
+        // The current run: its first frame and its number of frames.
+        unsigned int start = 0;
+        unsigned long long length = 0;
+        //every word before the summary word the last findFree stopped at is empty
+        size_t word = hint_ * 64;
+        while (word < words){
+            if (length == 0){
+                word = nextWord(word);
+                if (word == words){
+                    break;
+                }
+            }
+            uint64_t bits = leaves_[word];
+            if (bits == ~0ULL){
+                if (length == 0){
+                    start = word * 64;
+                }
+                size_t full = firstNot(leaves_.data(), word, words, ~0ULL);
+                length += (unsigned long long)(full - word) * 64;
+                if (length >= count){
+                    return start;
+                }
+                word = full;
+                continue;
+            }
+            //the run from the word before ends at the first allocated frame
+            if (length > 0){
+                length += __builtin_ctzll(~bits);
+                if (length >= count){
+                    return start;
+                }
+            }
+            //bit k of fits is set while frames k to k + width - 1 of the word are all free
+            if (count <= 64){
+                uint64_t fits = bits;
+                for (unsigned int width = 1; width < count && fits != 0;){
+                    unsigned int step = width < count - width ? width : count - width;
+                    fits &= fits >> step;
+                    width += step;
+                }
+                if (fits != 0){
+                    return word * 64 + __builtin_ctzll(fits);
+                }
+            }
+            //the free frames at the top of the word start the next run
+            length = __builtin_clzll(~bits);
+            if (length > 0){
+                start = word * 64 + 64 - length;
+            }
+            word++;
+        }
+        return NONE;
+    }
+
+private:
+    // A bit for every frame, set while the frame is free; the bits past the
+    // last frame are never set.
+    vector<uint64_t> leaves_;
+    // A bit for every word of leaves_, set while that word is not 0.
+    vector<uint64_t> summary_;
+    // The number of frames.
+    unsigned int size_ = 0;
+    // Every summary word before this one is 0.
+    size_t hint_ = 0;
+    Scan scan_ = bestScan();
+
+    // Finds the first word of leaves_ at or after a word that has a free frame.
+    // return: The word, or the number of words if none has.
+    size_t nextWord(const size_t &word){
+        size_t index = word / 64;
+        uint64_t bits = summary_[index] & (~0ULL << (word % 64));
+        if (bits == 0){
+            index = firstNot(summary_.data(), index + 1, summary_.size(), 0);
+            if (index == summary_.size()){
+                return leaves_.size();
+            }
+            bits = summary_[index];
+        }
+        return index * 64 + __builtin_ctzll(bits);
+    }
+
+    // Finds the first word that is not a given pattern.
+    // param words: The words.
+    // param from: The first word to look at.
+    // param to: Past the last word to look at.
+    // param pattern: The word to skip.
+    // return: The word, or to if every word is the pattern.
+    size_t firstNot(const uint64_t* words, const size_t &from, const size_t &to, const uint64_t &pattern){
+#if defined(__x86_64__) || defined(__i386__)
+        if (scan_ == AVX2){
+            return firstNotAVX2(words, from, to, pattern);
+        }
+        if (scan_ == SSE2){
+            return firstNotSSE2(words, from, to, pattern);
+        }
+#endif
+        return firstNotScalar(words, from, to, pattern);
+    }
+
+    static size_t firstNotScalar(const uint64_t* words, size_t from, const size_t &to, const uint64_t &pattern){
+        while (from < to && words[from] == pattern){
+            from++;
+        }
+        return from;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    // Skips 4 words at a time, then finds the word within the last 4.
+    __attribute__((target("avx2")))
+    static size_t firstNotAVX2(const uint64_t* words, size_t from, const size_t &to, const uint64_t &pattern){
+        __m256i skip = _mm256_set1_epi64x((long long)pattern);
+        for (; from + 4 <= to; from += 4){
+            __m256i block = _mm256_loadu_si256((const __m256i*)(words + from));
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(block, skip)) != -1){
+                break;
+            }
+        }
+        return firstNotScalar(words, from, to, pattern);
+    }
+
+    // Skips 2 words at a time; SSE2 compares 32 bits at a time, and two words
+    // are equal when both their halves are.
+    __attribute__((target("sse2")))
+    static size_t firstNotSSE2(const uint64_t* words, size_t from, const size_t &to, const uint64_t &pattern){
+        __m128i skip = _mm_set1_epi64x((long long)pattern);
+        for (; from + 2 <= to; from += 2){
+            __m128i block = _mm_loadu_si128((const __m128i*)(words + from));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(block, skip)) != 0xFFFF){
+                break;
+            }
+        }
+        return firstNotScalar(words, from, to, pattern);
+    }
+#endif
+};
+
+#endif
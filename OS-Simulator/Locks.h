@@ -0,0 +1,246 @@
+/*
+  Title          : Locks.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : spin lock primitives
+  Purpose        : Class project
+*/
+#ifndef __LOCKS_H__
+#define __LOCKS_H__
+
+#include <atomic>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/*
+Spinlocks::
+
+A spinlock is a lock that a process busy-waits on: while it cannot get the
+lock it loops, checking again. Spinning wastes CPU cycles, but no context
+switch is needed when the lock is short, which is why they are used on
+multiprocessors for locks held only for a short time.
+
+Atomic(TESTandSET).cpp spins on test_and_set itself, so every waiter writes
+the lock's cache line on every iteration. The locks here only write when
+the lock looks free, and differ in who gets it next:
+
+  TTASLock    test-and-test-and-set with exponential backoff; no order.
+  TicketLock  first come first served through a ticket counter.
+  MCSLock     first come first served; each waiter spins on its own node.
+  RWSpinLock  many readers or one writer; a waiting writer stops new readers.
+
+Each waiter yields its CPU after spinning for a while, so a lock still makes
+progress when there are more threads than cores. All of them except MCSLock
+meet the Lockable requirements and work with lock_guard.
+*/
+
+// Tells the CPU the thread is spinning.
+inline void cpuRelax(){
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+// Spins a while, then gives the CPU away once the thread has spun too long.
+class SpinWait{
+public:
+    void wait(){
+        if (spins_ < YIELD_AFTER){
+            spins_++;
+            cpuRelax();
+        } else {
+            this_thread::yield();
+        }
+    }
+
+private:
+    static const unsigned int YIELD_AFTER = 1 << 10;
+    unsigned int spins_ = 0;
+};
+
+class TTASLock{
+public:
+    TTASLock() = default;
+    TTASLock(const TTASLock &rhs) = delete;
+    TTASLock& operator=(const TTASLock &rhs) = delete;
+
+    void lock(){
+        unsigned int backoff = 1;
+        SpinWait spin;
+        while (true){
+            while (locked_.load(memory_order_relaxed)){
+                spin.wait();
+            }
+            if (!locked_.exchange(true, memory_order_acquire)){
+                return;
+            }
+            //lost the race: wait twice as long before the next attempt
+            for (unsigned int i = 0; i < backoff; i++){
+                cpuRelax();
+            }
+            backoff = backoff < MAX_BACKOFF ? backoff * 2 : MAX_BACKOFF;
+        }
+    }
+
+    bool try_lock(){
+        return !locked_.load(memory_order_relaxed) && !locked_.exchange(true, memory_order_acquire);
+    }
+
+    void unlock(){
+        locked_.store(false, memory_order_release);
+    }
+
+private:
+    static const unsigned int MAX_BACKOFF = 1 << 10;
+    atomic<bool> locked_{false};
+};
+
+class TicketLock{
+public:
+    TicketLock() = default;
+    TicketLock(const TicketLock &rhs) = delete;
+    TicketLock& operator=(const TicketLock &rhs) = delete;
+
+    void lock(){
+        unsigned int ticket = next_.fetch_add(1, memory_order_relaxed);
+        SpinWait spin;
+        while (serving_.load(memory_order_acquire) != ticket){
+            spin.wait();
+        }
+    }
+
+    bool try_lock(){
+        unsigned int serving = serving_.load(memory_order_relaxed);
+        unsigned int expected = serving;
+        return next_.compare_exchange_strong(expected, serving + 1, memory_order_acquire);
+    }
+
+    void unlock(){
+        serving_.store(serving_.load(memory_order_relaxed) + 1, memory_order_release);
+    }
+
+private:
+    atomic<unsigned int> next_{0};
+    atomic<unsigned int> serving_{0};
+};
+
+class MCSLock{
+public:
+    // The queue node of one waiter; lives on the waiter's stack while it holds
+    // or waits for the lock.
+    struct Node{
+        atomic<Node*> next_{nullptr};
+        atomic<bool> waiting_{false};
+    };
+
+    // Holds an MCSLock for the lifetime of the guard.
+    class Guard{
+    public:
+        explicit Guard(MCSLock &lock) : lock_(lock){ lock_.lock(node_); }
+        ~Guard(){ lock_.unlock(node_); }
+        Guard(const Guard &rhs) = delete;
+        Guard& operator=(const Guard &rhs) = delete;
+
+    private:
+        MCSLock &lock_;
+        Node node_;
+    };
+
+    MCSLock() = default;
+    MCSLock(const MCSLock &rhs) = delete;
+    MCSLock& operator=(const MCSLock &rhs) = delete;
+
+    void lock(Node &node){
+        node.next_.store(nullptr, memory_order_relaxed);
+        node.waiting_.store(true, memory_order_relaxed);
+        Node* previous = tail_.exchange(&node, memory_order_acq_rel);
+        if (previous == nullptr){
+            return;
+        }
+        previous->next_.store(&node, memory_order_release);
+        SpinWait spin;
+        while (node.waiting_.load(memory_order_acquire)){
+            spin.wait();
+        }
+    }
+
+    void unlock(Node &node){
+        Node* next = node.next_.load(memory_order_acquire);
+        if (next == nullptr){
+            Node* expected = &node;
+            if (tail_.compare_exchange_strong(expected, nullptr, memory_order_acq_rel)){
+                return;
+            }
+            //a waiter swapped itself in but has not linked to us yet
+            SpinWait spin;
+            while ((next = node.next_.load(memory_order_acquire)) == nullptr){
+                spin.wait();
+            }
+        }
+        next->waiting_.store(false, memory_order_release);
+    }
+
+private:
+    atomic<Node*> tail_{nullptr};
+};
+
+class RWSpinLock{
+public:
+    RWSpinLock() = default;
+    RWSpinLock(const RWSpinLock &rhs) = delete;
+    RWSpinLock& operator=(const RWSpinLock &rhs) = delete;
+
+    void lock(){
+        SpinWait spin;
+        while (true){
+            unsigned int state = state_.load(memory_order_relaxed);
+            if ((state & ~WRITER_WAITING) == 0){
+                if (state_.compare_exchange_weak(state, WRITER, memory_order_acquire)){
+                    return;
+                }
+            } else if ((state & WRITER_WAITING) == 0){
+                state_.fetch_or(WRITER_WAITING, memory_order_relaxed);
+            }
+            spin.wait();
+        }
+    }
+
+    bool try_lock(){
+        unsigned int state = state_.load(memory_order_relaxed);
+        return (state & ~WRITER_WAITING) == 0
+               && state_.compare_exchange_strong(state, WRITER, memory_order_acquire);
+    }
+
+    void unlock(){
+        state_.fetch_and(~WRITER, memory_order_release);
+    }
+
+    void lock_shared(){
+        SpinWait spin;
+        while (true){
+            unsigned int state = state_.load(memory_order_relaxed);
+            if ((state & (WRITER | WRITER_WAITING)) == 0
+                && state_.compare_exchange_weak(state, state + 1, memory_order_acquire)){
+                return;
+            }
+            spin.wait();
+        }
+    }
+
+    void unlock_shared(){
+        state_.fetch_sub(1, memory_order_release);
+    }
+
+private:
+    // The low bits count the readers holding the lock.
+    static const unsigned int WRITER = 1u << 31;
+    static const unsigned int WRITER_WAITING = 1u << 30;
+    atomic<unsigned int> state_{0};
+};
+
+#endif
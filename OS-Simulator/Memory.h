@@ -12,9 +12,19 @@
 #include <sstream>
 #include <iterator>
 #include <string>
+#include <list>
+#include <map>
+#include <vector>
 
 #include "Queues.h"
 #include "PCB.h"
+#include "Paging.h"
+#include "Pool.h"
+#include "TLB.h"
+#include "DiskWorkers.h"
+#include "Buddy.h"
+#include "Metrics.h"
+#include "Command.h"
 using namespace std;
 
 /*
@@ -44,327 +54,1320 @@ memory that is contiguous to the section containing the next process.
 
 */
 // MemFrag is a memory fragmentation in the memory tracker.
-// It can be attached to a process, or be a hole.
+// It can be attached to a process, or be a hole.
 
-struct MemFrag{
+struct MemFrag{
 
+    unsigned int start_;
     unsigned int byte_;
     PCB* owner_;
     bool hole_;
+    // Position of the fragment in the address ordered memory tracker.
+    list<MemFrag*>::iterator node_;
 
-    // Fragmentation with an l_value reference
-    MemFrag(const unsigned int &byte, PCB *owner, bool hole)
-            : byte_{byte}, owner_{owner}, hole_{hole}{}
+    // Fragmentation with an l_value reference
+    MemFrag(const unsigned int &start, const unsigned int &byte, PCB *owner, bool hole)
+            : start_{start}, byte_{byte}, owner_{owner}, hole_{hole}{}
 
-    // Fragmentation with an r_value reference
-    MemFrag(const unsigned int &&byte, PCB *owner, bool hole)
-            : byte_{move(byte)}, owner_{owner}, hole_{hole}{}
-};
-
-class Memory{
+    // Fragmentation with an r_value reference
+    MemFrag(const unsigned int &&start, const unsigned int &&byte, PCB *owner, bool hole)
+            : start_{move(start)}, byte_{move(byte)}, owner_{owner}, hole_{hole}{}
+};
+
+/*
+Best fit::
+
+Allocate the smallest hole that is big enough. We must search the entire
+list, unless the list is ordered by size. This strategy produces the
+smallest leftover hole.
+
+The holes are kept ordered by size, so the best fit is a single
+lower_bound. Each process holds a handle to its fragment, and the fragment
+its node in the list, which tiles the memory in address order: freeing a
+process goes straight to its fragment and merges it only with the nodes
+right before and after it. Allocation and deallocation are O(log n) in the
+number of holes, for updating the size order, however many processes are
+resident.
+*/
+class Memory : public MemoryBackend{
 public:
     // Default constructor.
-    Memory() = default;
+    Memory() = default;
+    Memory(const Memory &rhs) = delete;
+    Memory& operator=(const Memory &rhs) = delete;
 
-    // Constructor; Erases the node from memory.
-    ~Memory(){
-        for (auto it = memory_tracker_.begin(); it != memory_tracker_.end(); ++it){
-           memory_tracker_.erase(it);
-        }
-     }
+    // Destructor; The fragment pool frees every fragment in memory.
+    ~Memory() = default;
+
+    const char* name(){ return "list"; }
 
     // Sets up the initial memory after user input.
     // param mem: The user initiated memory.
     void setupMemory(const unsigned int &mem){
-       MemFrag* initial = new MemFrag{mem, nullptr, true};
-       memory_tracker_.push_back(initial);
+       MemFrag* initial = frag_pool_.acquire(0u, mem, nullptr, true);
+       initial->node_ = memory_tracker_.insert(memory_tracker_.end(), initial);
+       addHole(initial);
+       free_ = mem;
+    }
+
+    // Gets the bytes in holes.
+    unsigned long long getFreeBytes(){
+       return free_;
+    }
+
+    // Gets the bytes of the largest hole.
+    unsigned int getLargestHole(){
+       return holes_by_size_.empty() ? 0 : holes_by_size_.rbegin()->first.first;
+    }
+
+    // A process gets exactly the bytes it asks for.
+    unsigned long long getInternalFragmentation(){
+       return 0;
+    }
+
+    // Compaction leaves every free byte in one hole.
+    unsigned long long getCompactedLargestHole(){
+       return free_;
+    }
+
+    /*
+    Compaction::
+
+    A process may not fit in any hole even though the holes add up to more
+    than it needs. Compaction shuffles the memory contents so as to place
+    all free memory together in one large block: every resident process
+    slides down, in address order, to the end of the one before it, and the
+    holes between them become a single hole at the top of the memory.
+
+    Moving a process means copying all of its bytes, so the cost of a
+    compaction is the bytes of the processes that moved.
+    */
+    // Compacts the memory.
+    // return: The bytes moved.
+    unsigned long long compact(){
+       unsigned int next = 0;
+       unsigned long long moved = 0;
+       for (auto node = memory_tracker_.begin(); node != memory_tracker_.end();){
+        MemFrag* fragment = *node;
+        if (fragment->hole_ == true){
+            node = memory_tracker_.erase(node);
+            frag_pool_.release(fragment);
+            continue;
+        }
+        if (fragment->start_ != next){
+            fragment->start_ = next;
+            moved += fragment->byte_;
+        }
+        next += fragment->byte_;
+        ++node;
+       }
+       holes_by_size_.clear();
+       if (free_ > 0){
+        MemFrag* hole = frag_pool_.acquire(next, (unsigned int)free_, nullptr, true);
+        hole->node_ = memory_tracker_.insert(memory_tracker_.end(), hole);
+        addHole(hole);
+       }
+       return moved;
     }
 
-    // Allocates the memory needed for a process.
+    // Allocates the memory needed for a process in the smallest hole that fits.
     // param owner: The pointer to the process in memory being allocated.
     // return: True if memory allocated successfully. Otherwise false.
-    bool allocate(PCB* owner){
+    bool allocate(PCB* owner){
 
        unsigned int byte = owner->getMemorySize();
-       for(auto it = memory_tracker_.begin(); it != memory_tracker_.end(); ++it){
-        if(((*it)->hole_ == true && (*it)->byte_ >= byte)){
-            MemFrag* memory_node = new MemFrag(byte, owner, false);
-            cout << "Allocating memory...\n";
-            memory_tracker_.insert(it, memory_node);
-            auto it2 = it++;
-            (*it2)->byte_ -= byte;
-            //tail hole node has no memory left
-            if((*it2)->byte_ == 0){
-                memory_tracker_.pop_back();
-            }
-            return true;
-        }
-      }
-      //no memory available
-      return false;
-    }
-
+       auto best = holes_by_size_.lower_bound(make_pair(byte, 0u));
+       if(best == holes_by_size_.end()){
+           //no memory available
+           return false;
+       }
+       MemFrag* hole = best->second;
+       MemFrag* memory_node = frag_pool_.acquire(hole->start_, byte, owner, false);
+       memory_node->node_ = memory_tracker_.insert(hole->node_, memory_node);
+       owner->setFragment(memory_node);
+       free_ -= byte;
+
+       removeHole(hole);
+       hole->start_ += byte;
+       hole->byte_ -= byte;
+       //hole has no memory left
+       if(hole->byte_ == 0){
+           memory_tracker_.erase(hole->node_);
+           frag_pool_.release(hole);
+       } else {
+           addHole(hole);
+       }
+       return true;
+    }
+
 
     // Deallocates the memory for a process.
+    // The process itself belongs to the caller.
     // param owner: The pointer to the process in memory being deallocated.
     void deallocate(PCB* owner){
-      for(auto it = memory_tracker_.begin(); it != memory_tracker_.end(); ++it){
+      MemFrag* freed = owner->getFragment();
+      if(freed != nullptr && freed->owner_ == owner){
+          owner->setFragment(nullptr);
+          free_ += freed->byte_;
+          freed->owner_ = nullptr;
+          freed->hole_ = true;
+          merge(freed);
+      }
+   }
 
-        if((*it)->owner_ == owner){
+    // Gets the pool that owns every fragment.
+    ObjectPool<MemFrag>& getFragPool(){
+       return frag_pool_;
+    }
 
-            (*it)->owner_ = nullptr;
-            (*it)->hole_ = true;
+    string printPools(){
+       return frag_pool_.printPool("MemFrag");
+    }
 
-            break;
+    // Writes every fragment as its start, size and PID (0 for a hole).
+    void save(CheckpointWriter &out){
+       out.put<unsigned long long>(memory_tracker_.size());
+       for (auto &node: memory_tracker_){
+        out.put(node->start_);
+        out.put(node->byte_);
+        out.put(node->hole_ == true ? 0 : node->owner_->getPID());
+       }
+    }
+
+    void load(CheckpointReader &in, ProcessTable &table){
+       for (auto &node: memory_tracker_){
+        frag_pool_.release(node);
+       }
+       memory_tracker_.clear();
+       holes_by_size_.clear();
+       free_ = 0;
+       unsigned long long count = in.get<unsigned long long>();
+       for (unsigned long long i = 0; i < count && in.ok(); i++){
+        unsigned int start = in.get<unsigned int>();
+        unsigned int byte = in.get<unsigned int>();
+        PCB* owner = table.getProcess(in.get<int>());
+        MemFrag* node = frag_pool_.acquire(start, byte, owner, owner == nullptr);
+        node->node_ = memory_tracker_.insert(memory_tracker_.end(), node);
+        if (owner == nullptr){
+            addHole(node);
+            free_ += byte;
+        } else {
+            owner->setFragment(node);
         }
-      }
-     delete owner;
-     owner = nullptr;
-     merge();
-   }
+       }
+    }
 
-    // Gets a snapshot of the current memory.
-    // return: A string of the memory snapshot.
-    string printMemory(){
-       stringstream ss;
-       //range tracker
-       unsigned int start = 0;
-       auto it = memory_tracker_.end();
-       it--;
-       ss << " ===================================\n";
-       ss << "|       Random Access Memory        |\n";
-       ss << " ===================================\n\n";
+    // Writes a snapshot of the current memory.
+    void writeMemory(SnapshotWriter &out){
+       out << " ===================================\n";
+       out << "|       Random Access Memory        |\n";
+       out << " ===================================\n\n";
        for (auto &node: memory_tracker_){
-        ss << " -----------------------------------\n";
-        ss << "\t" << start << " -> " << start+node->byte_-1 << endl;
-        ss << " -----------------------------------\n\n";
+        out << " -----------------------------------\n";
+        out << "\t" << node->start_ << " -> " << node->start_+node->byte_-1 << '\n';
+        out << " -----------------------------------\n\n";
         if (node->hole_ == true){
-            ss << "\tEMPTY\n";
-            start += node->byte_;
+            out << "\tEMPTY\n";
         } else {
-            ss << node->owner_->getProcessInfo();
-            start += node->byte_;
+            node->owner_->writeProcessInfo(out);
         }
        }
-       return ss.str();
+    }
+
+    // Writes every fragment of the memory as a JSON lines record, keyed by
+    // its start address. A hole has a null PID.
+    void writeJSON(JSONSnapshot &fragments){
+       for (auto &node: memory_tracker_){
+        SnapshotWriter &out = fragments.record();
+        out << "\"start\":" << node->start_ << ",\"bytes\":" << node->byte_ << ",\"pid\":";
+        if (node->hole_ == true){
+            out << "null";
+        } else {
+            out << node->owner_->getPID();
+        }
+        fragments.commit(node->start_);
+       }
     }
 private:
+    // Owns every fragment; declared first so it is destroyed last.
+    ObjectPool<MemFrag> frag_pool_;
+
     // A list of MemFrag pointers where each node is a segment of memory.
-    // Could be filled with a process or empty.
+    // Could be filled with a process or empty. Ordered by address.
     list<MemFrag*> memory_tracker_;
 
-    // Merges any adjacent holes in the memory after a deallocation.
-    void merge(){
-       list<MemFrag*>::iterator it2;
-       for(auto it = memory_tracker_.begin(); it != prev(memory_tracker_.end()); ++it){
-        it2 = it;
-        it2++;
-        //adjacent holes
-        if(((*it)->hole_ == true) && ((*it2)->hole_ == true)){
-            (*it)->byte_ += (*it2)->byte_;
-            memory_tracker_.erase(it2);
-            it--;
-        }
+    // Every hole keyed by (size, start address); the best fit is the first
+    // key not smaller than (requested size, 0).
+    map<pair<unsigned int, unsigned int>, MemFrag*> holes_by_size_;
+
+    // The bytes in holes.
+    unsigned long long free_ = 0;
+
+    // Adds a hole to the size index.
+    // param hole: The hole being indexed.
+    void addHole(MemFrag* hole){
+       holes_by_size_[make_pair(hole->byte_, hole->start_)] = hole;
+    }
+
+    // Removes a hole from the size index.
+    // param hole: The hole being removed.
+    void removeHole(MemFrag* hole){
+       holes_by_size_.erase(make_pair(hole->byte_, hole->start_));
+    }
+
+    // Merges a freed fragment with its neighbors in the list, if they are holes.
+    // The list has no gaps, so they are the holes ending where it starts and
+    // starting where it ends.
+    // param freed: The fragment that was just released.
+    void merge(MemFrag* freed){
+       auto after = std::next(freed->node_);
+       if(after != memory_tracker_.end() && (*after)->hole_ == true){
+           MemFrag* next = *after;
+           removeHole(next);
+           freed->byte_ += next->byte_;
+           memory_tracker_.erase(after);
+           frag_pool_.release(next);
+       }
+       if(freed->node_ != memory_tracker_.begin()){
+           MemFrag* prev = *std::prev(freed->node_);
+           if(prev->hole_ == true){
+               removeHole(prev);
+               prev->byte_ += freed->byte_;
+               memory_tracker_.erase(freed->node_);
+               frag_pool_.release(freed);
+               freed = prev;
+           }
        }
+       addHole(freed);
     }
-};
-
-
-
+};
+
+
+
+
+// Creates a memory allocator.
+// param name: list (contiguous best fit) or buddy.
+// return: The allocator, or nullptr if there is none by that name.
+inline MemoryBackend* newMemoryBackend(const string &name){
+    if (name == "list"){
+        return new Memory();
+    } else if (name == "buddy"){
+        return new BuddyMemory();
+    }
+    return nullptr;
+}
 
 class System{
 
 public:
  // Constructor and Destructor
- // CPU is set to nullptr on start up as nothing in running in the CPU.
- System():cpu_(nullptr){};
- ~System() = default;
+ // Every CPU core is set to nullptr on start up as nothing in running in the CPU.
+ System():cpus_(1, nullptr){};
+ // The disk threads stop with the System; the requests they still have are
+ // completed first, so no process is left waiting for a disk that is gone.
+ ~System(){ drainDisks(); }
 
- // Gets the process that is using the CPU.
- // return: A pointer of the process.
+ // Gets the process that is using the CPU of the selected core.
+ // return: A pointer of the process.
  PCB* getCPUprocess(){
-                 return cpu_;
+                 return cpus_[core_];
+ }
+
+ // Gets the process that is using the CPU of a core.
+ PCB* getCPUprocess(const int &core){
+                 return cpus_[core];
  }
 
+ // Sets where the system reports every event and writes its snapshots.
+ // param output: The stream, or nullptr to drop them, e.g. when many systems run at once.
+ void setOutput(ostream* output){
+     output_ = output == nullptr ? &silent_ : output;
+     snapshot_.setSink(output_);
+ }
+
+ // Sets the memory allocator: list or buddy.
+ // Must be called before setupMemory.
+ // return: False if there is no allocator by that name. Otherwise true.
+ bool setAllocator(const string &name){
+     MemoryBackend* allocator = newMemoryBackend(name);
+     if(allocator == nullptr){
+         return false;
+     }
+     ram_.reset(allocator);
+     return true;
+ }
+
  void setupMemory(const unsigned int &mem_size){
      mem_size_ = mem_size;
-     ram_.setupMemory(mem_size_);
+     ram_->setupMemory(mem_size_);
+     //a RAM smaller than a page is a single frame
+     frames_.setupFrames(mem_size_, min(page_size_, mem_size_));
+     reportMemory();
+ }
+
+ // Sets the size of a page (and frame) in bytes.
+ // Must be called before setupMemory, which builds the frame table.
+ void setPageSize(const unsigned int &page_size){
+     page_size_ = page_size;
  }
 
-void setDisk(const int &num_disks){
-     //By default I have 5 IO devices
+// Sets the number of priority levels, 0 being the lowest.
+// Must be called before setDisk, which builds the queues.
+void setPriorityLevels(const int &num_priorities){
+     num_priorities_ = num_priorities;
+}
+
+// Gets the number of priority levels.
+int getPriorityLevels(){
+     return num_priorities_;
+}
+
+// The most CPU cores the system can have.
+static const int MAX_CORES = 64;
+
+// Sets the number of CPU cores, each with its own CPU and ready queue.
+// Must be called before setDisk, which builds the queues.
+// param cores: From 1 to MAX_CORES.
+void setCores(const int &cores){
+     cpus_.assign(cores, nullptr);
+     metrics_.setCores(cores);
+}
+
+// Gets the number of CPU cores.
+int getCores(){
+     return cpus_.size();
+}
+
+// Selects the core the 'Q', 't', 'd' and 'm' commands refer to ('c').
+// param command: c and the core number.
+// Typed form of the 'c' command.
+// return: False if there is no such core. Otherwise true.
+bool selectCore(const int &core){
+    if(core < 0 || core >= getCores()){
+        return false;
+    }
+    core_ = core;
+    return true;
+}
+
+// Gets the core the 'Q', 't', 'd' and 'm' commands refer to.
+int getCore(){
+    return core_;
+}
+
+// Turns the ready queue into a multilevel feedback queue.
+// Must be called before setDisk, which sets the quanta of the levels.
+void setFeedback(const bool &feedback){
+     feedback_ = feedback;
+}
+
+// Sets how many quanta a process keeps the CPU at each priority level,
+// starting from level 0; the last value repeats for the higher levels.
+// Must be called before setDisk, which sets the quanta of the levels.
+void setQuanta(const vector<unsigned int> &quanta){
+     requested_quanta_ = quanta;
+}
+
+// Gets how many quanta a process keeps the CPU at a priority level.
+unsigned int getQuantum(const int &priority){
+     return quanta_[priority];
+}
+
+// Serves every disk from its own thread instead of 'D' commands.
+// Must be called before setDisk, which starts the threads.
+// param service_us: How long a disk takes to serve a request, in microseconds.
+void setDiskWorkers(const unsigned int &service_us){
+     threaded_disks_ = true;
+     disk_service_us_ = service_us;
+}
+
+// Sets the scheduling policy of the ready queue: priority, fcfs, sjf, cfs or edf.
+// Must be called before setDisk, which builds the queues.
+// return: False if there is no policy by that name. Otherwise true.
+bool setPolicy(const string &policy){
+     unique_ptr<SchedulerPolicy> known(newSchedulerPolicy(policy, 1));
+     if(!known){
+         return false;
+     }
+     policy_ = policy;
+     return true;
+}
+
+// Sets how every disk picks its next request, and its number of cylinders.
+// Must be called before setDisk, which builds the queues.
+void setDiskScheduling(const DiskPolicy &policy, const unsigned int &cylinders){
+     disk_policy_ = policy;
+     cylinders_ = cylinders;
+}
+
+// Drives the virtual time of the metrics from an outside clock, such as the
+// event engine's, instead of the quanta spent in CPU.
+// param now: The time, in microseconds.
+void setClock(const unsigned long long &now){
+     external_clock_ = true;
+     metrics_.advance(now, busy_);
+     clock_ = now;
+}
+
+// Compacts the memory when a process does not fit in any hole but the
+// holes add up to enough, and when the external fragmentation passes a threshold.
+// param threshold: The external fragmentation in percent, from 0 to 100;
+//                  100 compacts only when a process does not fit.
+void setCompaction(const unsigned int &threshold){
+     compaction_ = true;
+     compact_above_ = threshold;
+}
+
+// Gets the number of cylinders of every disk.
+unsigned int getCylinders(){
+     return cylinders_;
+}
+
+// Gets the cylinders the head of a disk moved to reach the request it is serving.
+unsigned long long getDiskLastSeek(const int &device_num){
+     return queue_manager_.getDiskLastSeek(device_num);
+}
+
+// Gets the cylinders the head of a disk moved in total.
+unsigned long long getDiskTotalSeek(const int &device_num){
+     return queue_manager_.getDiskTotalSeek(device_num);
+}
+
+void setDisk(const int &num_disks){
+     //By default I have 5 IO devices
      const int &num_IO_ = 5;
      num_disks_ = num_disks;
      num_IO = num_IO_;
-     queue_manager_.setupQueues(num_disks_, num_IO);
+     queue_manager_.setupQueues(num_disks_, num_IO, num_priorities_, policy_, disk_policy_, cylinders_, getCores());
+     quanta_.assign(num_priorities_, 1);
+     for(int priority = 0; priority < num_priorities_; priority++){
+         if(!requested_quanta_.empty()){
+             quanta_[priority] = requested_quanta_[min((size_t)priority, requested_quanta_.size() - 1)];
+         } else if(feedback_){
+             //the lower the level, the longer the slice: 1 quantum at the top, doubling down to 64
+             quanta_[priority] = 1u << min(num_priorities_ - 1 - priority, 6);
+         }
+     }
+     if(threaded_disks_){
+         disk_workers_.start(num_disks_, disk_service_us_);
+     }
 }
 
-void setCPUProcess(PCB* process){
+void setCPUProcess(const int &core, PCB* process){
     if (process == nullptr){
-        cpu_ = nullptr;
+        cpus_[core] = nullptr;
+        busy_ &= ~(1ULL << core);
         return;
     }
-    cpu_ = process;
-    process->setState("Running");
+    if (process != cpus_[core] && process->getState() == READY){
+        process_table_.stopWaiting(process->getPID(), ticks_);
+        metrics_.dispatched(process->getPID());
+    }
+    cpus_[core] = process;
+    busy_ |= 1ULL << core;
+    process->setCore(core);
+    process->setState(RUNNING);
     process->setLock(true);
 }
 
-void newProcess(string &command, int &pid_tracker){
-    int priority = command[2]-'0';
-    unsigned int mem_needed = stoul(command.substr(4));
-
-    if(priority < 0 || priority > 4){
-        cout << "ERROR: Invalid priority level. < 1-4 >\n";
-        return;
+// Typed form of the 'A' command: creates a process and allocates its memory.
+// param priority: The priority of the process.
+// param mem_needed: The memory size of the process in bytes.
+// param pid_tracker: The current available ID for the process.
+// param burst: The CPU burst of the process in quanta, for sjf; 0 if unknown.
+// param deadline: The quanta from now the process must finish in, for edf; 0 if none.
+// param affinity: The only core the process may run on; -1 for any.
+// return: True if the process was created. Otherwise false.
+bool newProcess(const int &priority, const unsigned int &mem_needed, int &pid_tracker,
+                const unsigned long long &burst = 0, const unsigned long long &deadline = 0,
+                const int &affinity = -1){
+    if(priority < 0 || priority >= num_priorities_){
+        *output_ << "ERROR: Invalid priority level. < 0-" << num_priorities_ - 1 << " >\n";
+        return false;
     }
 
     if(mem_needed <= 0){
-        cout << "ERROR: Invalid memory size.\n";
-        return;
+        *output_ << "ERROR: Invalid memory size.\n";
+        return false;
     }
 
-    PCB* new_process = new PCB(pid_tracker, priority, mem_needed);
-    if(!ram_.allocate(new_process)){
-        cout << "ERROR: No memory available for process.\n";
-        return;
+    if(affinity < -1 || affinity >= getCores()){
+        *output_ << "ERROR: Invalid core. < 0-" << getCores() - 1 << " >\n";
+        return false;
+    }
+
+    metrics_.event(now(), busy_);
+    PCB* new_process = pcb_pool_.acquire(process_table_, pid_tracker, priority, mem_needed);
+    bool allocated = ram_->allocate(new_process);
+    if(!allocated && compaction_ && ram_->canFitAfterCompaction(mem_needed)){
+        //the holes add up to enough memory
+        compactMemory();
+        allocated = ram_->allocate(new_process);
     }
+    if(!allocated){
+        pcb_pool_.release(new_process);
+        metrics_.rejected();
+        *output_ << "ERROR: No memory available for process.\n";
+        return false;
+    }
+    *output_ << "Allocating memory...\n";
+    sampleMemory();
+    metrics_.arrived(new_process->getPID());
     pid_tracker++;
+    new_process->setBurst(burst);
+    new_process->setDeadline(deadline > 0 ? ticks_ + deadline : 0);
+    new_process->setAffinity(affinity);
+    process_table_.startWaiting(new_process->getPID(), ticks_);
+    //the first page is loaded when the process is created
+    unsigned int frame;
+    frames_.reference(new_process, 0, frame);
+    invalidateEvicted();
 
     checkCPU(new_process);
-    cout << "Adding new process...\n";
+    *output_ << "Adding new process...\n";
+    return true;
 }
 
 void terminate(){
-    if(cpu_ == nullptr){
-        cout << "ERROR: Nothing running in CPU!\n";
+    if(cpus_[core_] == nullptr){
+        *output_ << "ERROR: Nothing running in CPU!\n";
         return;
     }
-    cout << "Terminating current process...\n";
+    *output_ << "Terminating current process...\n";
+    metrics_.event(now(), busy_);
+    metrics_.terminated(cpus_[core_]->getPID());
 
-    ram_.deallocate(cpu_);
+    tlb_.flush(cpus_[core_]->getPID());
+    frames_.release(cpus_[core_]);
+    ram_->deallocate(cpus_[core_]);
+    sampleMemory();
+    completed_++;
+    waited_ += process_table_.getWaited(cpus_[core_]->getPID());
+    pcb_pool_.release(cpus_[core_]);
 
-    getNextProcess();
+    getNextProcess(core_);
     return;
 }
 
-void requestIO(string &command){
-    int device_num = command[2]-'0';
+/*
+Round robin and multilevel feedback queue::
 
-    //checking if theres a valid process in cpu
-    if(cpu_ == nullptr){
-        cout << "ERROR: No process running in CPU!\n";
+Every 'Q' is one time quantum spent by the process in CPU. A process keeps
+the CPU for as many quanta as its priority level allows (its time slice),
+then goes to the back of the ready queue of its level, so the processes of
+one level take turns (round robin). A higher priority process still
+preempts it at once.
+
+With feedback, a process that uses up a whole time slice is CPU bound and
+is demoted one level, where the slices are longer. A process coming back
+from a disk is I/O bound and is promoted one level, up to the priority it
+arrived with.
+*/
+
+// The process in CPU spent one time quantum ('Q').
+void expireQuantum(){
+    if(cpus_[core_] == nullptr){
+        *output_ << "ERROR: Nothing running in CPU!\n";
         return;
     }
-    if(command[0] == 'p'){
-        if(device_num >= num_IO){
-            cout << "ERROR: I/O devices does not exist!\n";
-            return;
-        }
-        queue_manager_.addToIO_Queue(device_num,cpu_);
-        cout << "Requesting IO number " << device_num << "...\n";
-    } else if (command[0] == 'd'){
-        if(device_num >= num_disks_){
-            cout << "ERROR: Disk does not exist!\n";
-            return;
-        }
-        queue_manager_.addToDiskQueue(device_num,cpu_);
-        cout << "Requesting disk number " << device_num << "...\n";
+    int pid = cpus_[core_]->getPID();
+    int priority = cpus_[core_]->getPriority();
+    unsigned int used = process_table_.addQuantum(pid);
+    ticks_++;
+    metrics_.event(now(), busy_);
+    if(!queue_manager_.getPolicy(core_).expired(cpus_[core_], used, quanta_[priority])){
+        *output_ << "Process " << pid << " spent quantum " << used << "...\n";
+        return;
     }
-    getNextProcess();
+    *output_ << "Time slice of process " << pid << " expired...\n";
+    process_table_.resetSlice(pid);
+    if(feedback_ && priority > 0){
+        cpus_[core_]->setPriority(priority - 1);
+        *output_ << "Demoting process " << pid << " to priority " << priority - 1 << "...\n";
+    }
+    makeReady(cpus_[core_], core_);
+    getNextProcess(core_);
 }
 
+// Typed form of the 'd' command: the process in CPU waits for a disk.
+// param device_num: The disk number.
+// param file: The file the process reads or writes.
+// param cylinder: The cylinder the file is on.
+void requestIO(const int &device_num, const string &file = "", const unsigned int &cylinder = 0){
+    //checking if theres a valid process in cpu
+    if(cpus_[core_] == nullptr){
+        *output_ << "ERROR: No process running in CPU!\n";
+        return;
+    }
+    if(device_num < 0 || device_num >= num_disks_){
+        *output_ << "ERROR: Disk does not exist!\n";
+        return;
+    }
+    if(cylinder >= cylinders_){
+        *output_ << "ERROR: Cylinder does not exist! < 0-" << cylinders_ - 1 << " >\n";
+        return;
+    }
+    metrics_.event(now(), busy_);
+    metrics_.blocked(cpus_[core_]->getPID());
+    process_table_.resetSlice(cpus_[core_]->getPID());
+    cpus_[core_]->setIORequest(file, cylinder);
+    queue_manager_.addToDiskQueue(device_num,cpus_[core_]);
+    if(disk_workers_.isRunning()){
+        disk_workers_.submit(device_num);
+    }
+    *output_ << "Requesting disk number " << device_num << "...\n";
+    getNextProcess(core_);
+}
 
-void interruptDisk(string &command){
-    int device_num = command[2]-'0';
 
-    if(device_num >= num_disks_){
-        cout << "ERROR: Disk does not exist!\n";
+// Typed form of the 'D' command: a disk finished the request of the process using it.
+// param device_num: The disk number.
+void interruptDisk(const int &device_num){
+    if(device_num < 0 || device_num >= num_disks_){
+        *output_ << "ERROR: Disk does not exist!\n";
+        return;
+    }
+    if (disk_workers_.isRunning()){
+        *output_ << "ERROR: Disk " << device_num << " is served by its own thread!\n";
         return;
     }
     if (queue_manager_.isDiskEmpty(device_num)){
-        cout << "ERROR: Nothing in disk " << device_num << "!\n";
+        *output_ << "ERROR: Nothing in disk " << device_num << "!\n";
         return;
     }
+    completeIO(device_num);
+}
+
+// Handles the interrupts of every disk thread that finished a request.
+// return: The number of requests that finished.
+int pollDisks(){
+    int finished = 0;
+    DiskRequest done;
+    while(disk_workers_.poll(done)){
+        completeIO(done.disk_);
+        finished++;
+    }
+    return finished;
+}
+
+// Waits until the disk threads finished every request handed to them.
+void drainDisks(){
+    while(disk_workers_.inFlight() > 0){
+        if(pollDisks() == 0){
+            this_thread::yield();
+        }
+    }
+}
+
+// The process using a disk finished its request and goes back to the CPU scheduler.
+// param device_num: The disk number.
+void completeIO(int device_num){
     PCB* process_ending = queue_manager_.getDiskProcess(device_num);
+    metrics_.event(now(), busy_);
+    metrics_.unblocked(process_ending->getPID());
 
     queue_manager_.removeFromDiskQueue(device_num);
+    if(feedback_ && process_ending->getPriority() < process_ending->getBasePriority()){
+        process_ending->setPriority(process_ending->getPriority() + 1);
+    }
     checkCPU(process_ending);
-    cout << "Interrupting disk number " << device_num << "...\n";
+    *output_ << "Interrupting disk number " << device_num << "...\n";
 }
 
-void snapshot(string &command){
-    if(command[2] == 'r'){
-        cout << printReadyQueue();
+// The process in CPU references a logical address ('m').
+// The page holding it is loaded on a fault, evicting the least recently used frame if RAM is full.
+// param address: The logical address, from 0.
+void accessMemory(const unsigned long long &address){
+    if(cpus_[core_] == nullptr){
+        *output_ << "ERROR: No process running in CPU!\n";
         return;
-    } else if (command[2] == 'i'){
-        cout << queue_manager_.printIO_Queue();
+    }
+    if(address >= (unsigned int)cpus_[core_]->getMemorySize()){
+        *output_ << "ERROR: Address is outside the memory of process " << cpus_[core_]->getPID() << "!\n";
         return;
-    } else if (command[2] == 'm'){
-        cout << ram_.printMemory();
+    }
+    int pid = cpus_[core_]->getPID();
+    unsigned int page = address / frames_.getPageSize();
+    unsigned int frame;
+    //the TLB is tagged with the PID, so it survives context switches
+    if(tlb_.lookup(pid, page, frame)){
+        frames_.touch(frame);
+        *output_ << "TLB hit: page " << page << " is in frame " << frame << "...\n";
         return;
     }
-    cout << "ERROR: Invalid screenshot option.\n";
+    bool resident = frames_.reference(cpus_[core_], page, frame);
+    tlb_.recordWalk(pid, !resident);
+    invalidateEvicted();
+    tlb_.insert(pid, page, frame);
+    if(resident){
+        *output_ << "Accessing page " << page << " in frame " << frame << "...\n";
+    } else {
+        *output_ << "Page fault: loading page " << page << " into frame " << frame << "...\n";
+    }
 }
 
-string printReadyQueue(){
-    stringstream ss;
-    ss << " ===================================\n";
-    ss << "|              C P U                |\n";
-    ss << " ===================================\n\n";
-    ss << (cpu_ == nullptr ? "\tNo Process Running\n" : cpu_->getProcessInfo()) <<endl << endl;
+// Drops the TLB entry of a page the frame table just evicted.
+void invalidateEvicted(){
+    int pid;
+    unsigned int page;
+    if(frames_.evicted(pid, page)){
+        tlb_.invalidate(pid, page);
+    }
+}
 
+// Gets the TLB, to configure it before the simulation starts.
+// return: A reference to the TLB.
+TLB& getTLB(){
+    return tlb_;
+}
+
+// Prints a snapshot. The ready queue, disks and memory can also be written
+// as JSON lines ("S r j"), or as the JSON records that changed since their
+// last snapshot ("S r d").
+// param kind: The snapshot: r, i, m, t, p, a or s.
+// param format: ' ' for text, or j or d.
+void snapshot(const char &kind, const char &format){
+    if(format != ' ' && ((format != 'j' && format != 'd') || string("rim").find(kind) == string::npos)){
+        *output_ << "ERROR: Invalid screenshot option.\n";
+        return;
+    }
+    if(format != ' '){
+        writeJSON(kind, format == 'd');
+        snapshot_.flush();
+        return;
+    }
+    if(kind == 'r'){
+        writeReadyQueue(snapshot_);
+        snapshot_.flush();
+        return;
+    } else if (kind == 'i'){
+        queue_manager_.writeIO_Queue(snapshot_);
+        snapshot_.flush();
+        return;
+    } else if (kind == 'm'){
+        ram_->writeMemory(snapshot_);
+        snapshot_ << '\n';
+        frames_.writeFrames(snapshot_);
+        snapshot_.flush();
+        return;
+    } else if (kind == 't'){
+        *output_ << tlb_.printTLB();
+        return;
+    } else if (kind == 'p'){
+        *output_ << printPools();
+        return;
+    } else if (kind == 'a'){
+        *output_ << process_table_.printTable();
+        return;
+    } else if (kind == 's'){
+        writeMetrics(snapshot_);
+        snapshot_.flush();
+        return;
+    }
+    *output_ << "ERROR: Invalid screenshot option.\n";
+}
+
+// Gets the counters of the object pools.
+// return: A string of the pool snapshot.
+string printPools(){
+    stringstream ss;
     ss << " ===================================\n";
-    ss << "|       R E A D Y  Q U E U E        |\n";
+    ss << "|         O B J E C T  P O O L S    |\n";
     ss << " ===================================\n\n";
-    ss << queue_manager_.printReadyQueue();
+    ss << pcb_pool_.printPool("PCB");
+    ss << ram_->printPools();
     return ss.str();
 }
 
-void getNextProcess(){
-    PCB* next = queue_manager_.getNextProcess();
-    if (next != nullptr){
-        setCPUProcess(next);
-        queue_manager_.removeFromReadyQueue(next->getPriority());
+// Writes the CPU and the ready queue.
+void writeReadyQueue(SnapshotWriter &out){
+    out << " ===================================\n";
+    out << "|              C P U                |\n";
+    out << " ===================================\n\n";
+    int cores = getCores();
+    for (int core = 0; core < cores; core++){
+        if (cores > 1){
+            out << "Core Number: " << core << "\n\n";
+        }
+        if (cpus_[core] == nullptr){
+            out << "\tNo Process Running\n";
+        } else {
+            cpus_[core]->writeProcessInfo(out);
+        }
+        out << '\n';
     }
-    setCPUProcess(next);
-}
+    out << '\n';
 
-//if cpu is empty, add the new process to cpu
-
-//else check the prority of the new process, if new has
-//higher priority, preempt the running process and add the
-//new process.
+    out << " ===================================\n";
+    out << "|       R E A D Y  Q U E U E        |\n";
+    out << " ===================================\n\n";
+    for (int core = 0; core < cores; core++){
+        if (cores > 1){
+            out << "Core Number: " << core << "\n\n";
+        }
+        queue_manager_.writeReadyQueue(out, core);
+        if (core + 1 < cores){
+            out << '\n';
+        }
+    }
+}
 
+// Writes a snapshot as JSON lines records.
+// param kind: r for the CPU and ready queue, i for the disks, m for the memory and frames.
+// param delta: Write only the records that changed since the last snapshot of that kind.
+void writeJSON(const char &kind, const bool &delta){
+    snapshots_++;
+    if (kind == 'r'){
+        ready_json_.begin(snapshot_, snapshots_, delta);
+        auto record = [this](PCB* process){
+            process->writeJSON(ready_json_.record());
+            ready_json_.commit(process->getPID());
+        };
+        for (auto &cpu: cpus_){
+            if (cpu != nullptr){
+                record(cpu);
+            }
+        }
+        for (int core = 0; core < getCores(); core++){
+            queue_manager_.getPolicy(core).visit(record);
+        }
+        ready_json_.end();
+    } else if (kind == 'i'){
+        disk_json_.begin(snapshot_, snapshots_, delta);
+        request_json_.begin(snapshot_, snapshots_, delta);
+        queue_manager_.writeDiskJSON(disk_json_, request_json_);
+        disk_json_.end();
+        request_json_.end();
+    } else {
+        memory_json_.begin(snapshot_, snapshots_, delta);
+        frame_json_.begin(snapshot_, snapshots_, delta);
+        ram_->writeJSON(memory_json_);
+        frames_.writeJSON(frame_json_);
+        memory_json_.end();
+        frame_json_.end();
+    }
+}
+
+/*
+Multi-core::
+
+Every core has its own CPU and its own ready queue, scheduled by its own
+instance of the policy, so the cores never share a queue. A process that
+becomes ready goes to the core it is pinned to (its affinity), else to an
+idle core, its last one first because its cache is still warm there, else
+to the core with the fewest ready processes. A core that runs out of ready
+processes steals one from the busiest other core (see QueueManager::steal).
+Each move to another core is a migration.
+*/
+// Gives the CPU of a core to the next process of its ready queue, or to one
+// stolen from another core if its queue is empty.
+void getNextProcess(const int &core){
+    PCB* next = queue_manager_.getNextProcess(core);
+    if (next != nullptr){
+        queue_manager_.removeFromReadyQueue(next);
+    } else {
+        int from;
+        next = queue_manager_.steal(core, from);
+        if (next != nullptr){
+            metrics_.migrated();
+            *output_ << "Core " << core << " took process " << next->getPID() << " from core " << from << "...\n";
+        }
+    }
+    setCPUProcess(core, next);
+}
+
+// Picks the core a process that became ready goes to.
+int placeCore(PCB* process){
+    if (process->getAffinity() >= 0){
+        return process->getAffinity();
+    }
+    int last = process->getCore();
+    if (last >= 0 && cpus_[last] == nullptr){
+        return last;
+    }
+    int best = last >= 0 ? last : 0;
+    for (int core = 0; core < getCores(); core++){
+        if (cpus_[core] == nullptr){
+            return core;
+        }
+        if (queue_manager_.getReadyCount(core) < queue_manager_.getReadyCount(best)){
+            best = core;
+        }
+    }
+    return best;
+}
+
+//if the cpu of its core is empty, add the new process to cpu
+
+//else ask the scheduling policy whether the new process
+//preempts the running process; if so, the running process
+//goes back to the ready queue.
+
 void checkCPU(PCB* process){
+
+    int core = placeCore(process);
+    if (queue_manager_.migrate(process, core)){
+        metrics_.migrated();
+    }
+    SchedulerPolicy &policy = queue_manager_.getPolicy(core);
+    policy.wake(process);
+    if (cpus_[core] == nullptr){
+        setCPUProcess(core, process);
+        return;
+    } else if (!policy.preempts(process, cpus_[core])){
+        makeReady(process, core);
+        return;
+    } else {
+
+        metrics_.preempted();
+        makeReady(cpus_[core], core);
+        setCPUProcess(core, process);
+
+        return;
+    }
+}
+
+// Gets the number of processes that terminated.
+unsigned long long getCompleted(){
+    return completed_;
+}
+
+// Gets the number of time quanta spent in CPU ('Q').
+unsigned long long getTicks(){
+    return ticks_;
+}
+
+// Gets the mean quanta the terminated processes waited in the ready queue.
+double getMeanWait(){
+    return completed_ > 0 ? (double)waited_ / completed_ : 0;
+}
+
+// Gets the histograms and counters behind 'S s'.
+Metrics& getMetrics(){
+    return metrics_;
+}
+
+// Gets the waiting time and throughput of the processes that terminated, in quanta.
+// return: A string of the scheduling summary.
+string printSchedulerStats(){
+    stringstream ss;
+    ss << "Policy " << queue_manager_.getPolicy().name() << ": " << completed_ << " processes completed in "
+       << ticks_ << " quanta, mean waiting time " << (completed_ > 0 ? (double)waited_ / completed_ : 0)
+       << " quanta, throughput " << (ticks_ > 0 ? (double)completed_ / ticks_ : 0) << " per quantum\n";
+    return ss.str();
+}
+
+// Gets every scheduling and memory metric.
+// return: A string of the metrics.
+string printMetrics(){
+    SnapshotWriter out;
+    writeMetrics(out);
+    return out.str();
+}
 
-    if (cpu_ == nullptr){
-        setCPUProcess(process);
-        return;
-    } else if (process->getPriority() <= cpu_->getPriority()){
-        queue_manager_.addToReadyQueue(process);
-        return;
-    } else if (process->getPriority() > cpu_->getPriority()){
+// Writes every scheduling and memory metric, as in printMetrics.
+void writeMetrics(SnapshotWriter &out){
+    metrics_.write(out, external_clock_ ? "us" : "quanta");
+}
 
-        queue_manager_.addToReadyQueue(cpu_);
-        setCPUProcess(process);
+// Gets the virtual time: the event engine's clock if it drives the system,
+// otherwise the quanta spent in CPU.
+unsigned long long now(){
+    return external_clock_ ? clock_ : ticks_;
+}
 
+// Samples the free memory and the largest hole after the memory changed,
+// and compacts it if it is too fragmented: if the largest hole is too far
+// below the largest one compaction would leave. For the contiguous memory
+// that is the external fragmentation; the buddy system rounds its blocks to
+// powers of 2, and cannot always put all its free bytes in one block.
+void sampleMemory(){
+    metrics_.memory(ram_->getFreeBytes(), ram_->getLargestHole(), ram_->getInternalFragmentation());
+    if(!compaction_){
         return;
     }
+    unsigned long long best = ram_->getCompactedLargestHole();
+    if(ram_->getLargestHole() < best && 1000 - ram_->getLargestHole() * 1000 / best > compact_above_ * 10){
+        compactMemory();
+    }
 }
 
-private:
-    // A pointer to a process that is currently using the CPU.
-    PCB* cpu_;
+// Reports the free memory and the largest hole without sampling them,
+// once the memory is set up or restored.
+void reportMemory(){
+    metrics_.setMemory(ram_->getFreeBytes(), ram_->getLargestHole(), ram_->getInternalFragmentation());
+}
+
+// Compacts the memory and counts the bytes it moved.
+void compactMemory(){
+    unsigned long long moved = ram_->compact();
+    metrics_.compacted(moved);
+    metrics_.memory(ram_->getFreeBytes(), ram_->getLargestHole(), ram_->getInternalFragmentation());
+    *output_ << "Compacting memory: moved " << moved << " bytes...\n";
+}
+
+// Puts a process in the ready queue of a core and starts counting its waiting time.
+void makeReady(PCB* process, const int &core){
+    process_table_.startWaiting(process->getPID(), ticks_);
+    metrics_.readied(process->getPID());
+    queue_manager_.addToReadyQueue(process, core);
+}
+
+// Runs one command of the console or of a trace against the system.
+// param command: The parsed command.
+// param pid_tracker: The current available ID for the process.
+// return: False if the system has no such command. Otherwise true.
+bool execute(const Command &command, int &pid_tracker){
+    if(command.op_ == 'A'){
+        newProcess(command.priority_, command.memory_, pid_tracker, command.burst_, command.deadline_, command.core_);
+    } else if(command.op_ == 'd') {
+        requestIO(command.disk_, command.file_.str(), command.cylinder_);
+    } else if (command.op_ == 'D'){
+        interruptDisk(command.disk_);
+    } else if (command.op_ == 'S'){
+        snapshot(command.snapshot_, command.format_);
+    } else if (command.op_ == 't'){
+        terminate();
+    } else if (command.op_ == 'm'){
+        accessMemory(command.address_);
+    } else if (command.op_ == 'Q'){
+        expireQuantum();
+    } else if (command.op_ == 'C'){
+        checkpoint(command.path_.str(), pid_tracker);
+    } else if (command.op_ == 'R'){
+        restore(command.path_.str(), pid_tracker);
+    } else if (command.op_ == 'c'){
+        if(!selectCore(command.core_)){
+            *output_ << "ERROR: Invalid core. < 0-" << getCores() - 1 << " >\n";
+        } else {
+            *output_ << "Switching to core " << command.core_ << "...\n";
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Writes the whole state of the system to a checkpoint file ('C'), to be
+// restored by another run with the same setup.
+// param path: The file.
+// param pid_tracker: The current available ID for the process.
+void checkpoint(const string &path, int &pid_tracker){
+    if(disk_workers_.isRunning()){
+        *output_ << "ERROR: Cannot checkpoint while disk threads are running.\n";
+        return;
+    }
+    CheckpointWriter out;
+    out.putString(configuration());
+    out.put(pid_tracker);
+    out.put(ticks_);
+    out.put(completed_);
+    out.put(waited_);
+    out.put(external_clock_);
+    out.put(clock_);
+    vector<int> cpus;
+    for(auto &cpu: cpus_){
+        cpus.push_back(cpu == nullptr ? 0 : cpu->getPID());
+    }
+    out.putVector(cpus);
+    out.put(core_);
+    out.put<unsigned long long>(process_table_.live());
+    for(size_t pid = 0; pid < process_table_.slots(); pid++){
+        PCB* process = process_table_.getProcess(pid);
+        if(process != nullptr){
+            out.put(process->getPID());
+            out.put(process->getBasePriority());
+            out.put(process->getMemorySize());
+            process->save(out);
+        }
+    }
+    ram_->save(out);
+    frames_.save(out);
+    tlb_.save(out);
+    queue_manager_.save(out);
+    metrics_.save(out);
+    if(!out.save(path)){
+        *output_ << "ERROR: Cannot write checkpoint " << path << ".\n";
+        return;
+    }
+    *output_ << "Checkpoint of " << process_table_.live() << " processes saved to " << path
+         << " (" << out.size() << " bytes)...\n";
+}
+
+// Restores the whole state of the system from a checkpoint file ('R').
+// The system must have the same setup as the one that wrote it, and no processes.
+// param path: The file.
+// param pid_tracker: Set to the available ID saved in the checkpoint.
+void restore(const string &path, int &pid_tracker){
+    if(disk_workers_.isRunning()){
+        *output_ << "ERROR: Cannot restore while disk threads are running.\n";
+        return;
+    }
+    if(process_table_.live() > 0){
+        *output_ << "ERROR: Restore needs a system without processes.\n";
+        return;
+    }
+    CheckpointReader in;
+    string error;
+    if(!in.open(path, error)){
+        *output_ << "ERROR: " << error << ".\n";
+        return;
+    }
+    string saved = in.getString();
+    if(saved != configuration()){
+        *output_ << "ERROR: Checkpoint was taken with " << saved << ", this system has " << configuration() << ".\n";
+        return;
+    }
+    //the counters are kept aside until the whole checkpoint has been read
+    int pid = in.get<int>();
+    unsigned long long ticks = in.get<unsigned long long>();
+    unsigned long long completed = in.get<unsigned long long>();
+    unsigned long long waited = in.get<unsigned long long>();
+    bool external_clock = in.get<bool>();
+    unsigned long long clock = in.get<unsigned long long>();
+    vector<int> cpus = in.getVector<int>();
+    int core = in.get<int>();
+    unsigned long long count = in.get<unsigned long long>();
+    bool valid = in.ok() && core >= 0 && core < getCores();
+    for(unsigned long long i = 0; i < count && valid; i++){
+        int process_pid = in.get<int>();
+        int base_priority = in.get<int>();
+        int mem = in.get<int>();
+        valid = in.ok() && process_pid > 0 && process_table_.getProcess(process_pid) == nullptr;
+        if(valid){
+            pcb_pool_.acquire(process_table_, process_pid, base_priority, mem)->load(in);
+        }
+    }
+    if(valid){
+        ram_->load(in, process_table_);
+        frames_.load(in, process_table_);
+        tlb_.load(in);
+        queue_manager_.load(in, process_table_);
+        metrics_.load(in);
+    }
+    if(!valid || !in.ok()){
+        reset();
+        *output_ << "ERROR: Checkpoint " << path << " does not match the system it was taken of.\n";
+        return;
+    }
+    pid_tracker = pid;
+    ticks_ = ticks;
+    completed_ = completed;
+    waited_ = waited;
+    external_clock_ = external_clock;
+    clock_ = clock;
+    core_ = core;
+    busy_ = 0;
+    for(int cpu = 0; cpu < getCores() && cpu < (int)cpus.size(); cpu++){
+        cpus_[cpu] = process_table_.getProcess(cpus[cpu]);
+        if(cpus_[cpu] != nullptr){
+            busy_ |= 1ULL << cpu;
+        }
+    }
+    reportMemory();
+    *output_ << "Restored " << count << " processes from " << path << "...\n";
+}
+
+private:
+    // Sets the system up again as it was before any process arrived, after a
+    // restore that failed partway. The counters of the run so far are lost.
+    void reset(){
+        cpus_.assign(getCores(), nullptr);
+        busy_ = 0;
+        core_ = 0;
+        queue_manager_.setupQueues(num_disks_, num_IO, num_priorities_, policy_, disk_policy_, cylinders_, getCores());
+        ram_.reset(newMemoryBackend(ram_->name()));
+        ram_->setupMemory(mem_size_);
+        frames_.setupFrames(mem_size_, min(page_size_, mem_size_));
+        tlb_.clear();
+        metrics_ = Metrics();
+        metrics_.setCores(getCores());
+        reportMemory();
+        for(size_t pid = 0; pid < process_table_.slots(); pid++){
+            pcb_pool_.release(process_table_.getProcess(pid));
+        }
+        ticks_ = 0;
+        completed_ = 0;
+        waited_ = 0;
+    }
+
+    // Describes the setup a checkpoint can only be restored into.
+    string configuration(){
+        stringstream ss;
+        ss << mem_size_ << " bytes of " << ram_->name() << " memory, " << page_size_ << " byte pages, "
+           << getCores() << " cores, " << num_disks_ << " disks of " << cylinders_ << " cylinders (" << diskPolicyName(disk_policy_) << "), "
+           << num_priorities_ << " priorities (" << policy_ << "), " << tlb_.geometry();
+        return ss.str();
+    }
+
+    // The state of every process by PID; outlives the PCBs that update it.
+    ProcessTable process_table_;
+    // Owns every process; destroyed after the rest of the system, before the process table.
+    ObjectPool<PCB> pcb_pool_;
+    // A pointer to the process that is currently using the CPU of each core.
+    vector<PCB*> cpus_;
+    // Bit k is set while core k runs a process.
+    unsigned long long busy_ = 0;
+    // The core the 'Q', 't', 'd' and 'm' commands refer to.
+    int core_ = 0;
     // The memory size of the system.
     unsigned int mem_size_;
     // The number of disks in the system.
     int num_disks_;
     // The number of IO in the system.
     int num_IO;
+    // The number of priority levels in the ready queue.
+    int num_priorities_ = 5;
     // An instance of a queue manager.
     QueueManager queue_manager_;
-    // An instance of RAM.
-    Memory ram_;
+    // The allocator of the RAM; contiguous best fit unless setAllocator picks another.
+    unique_ptr<MemoryBackend> ram_{new Memory()};
+    // The size of a page (and frame) in bytes.
+    unsigned int page_size_ = 4096;
+    // The frames of the RAM and which page of which process each one holds.
+    FrameTable frames_;
+    // Caches the page translations of every process.
+    TLB tlb_;
+    // The name of the scheduling policy of the ready queue.
+    string policy_ = "priority";
+    // The quanta spent in CPU by every process; the clock of the scheduler.
+    unsigned long long ticks_ = 0;
+    // The processes that terminated, and the quanta they waited in the ready queue.
+    unsigned long long completed_ = 0;
+    unsigned long long waited_ = 0;
+    // Whether the ready queue is a multilevel feedback queue.
+    bool feedback_ = false;
+    // The quanta of a time slice at each priority level, and the ones asked for by setQuanta.
+    vector<unsigned int> quanta_;
+    vector<unsigned int> requested_quanta_;
+    // How every disk picks its next request, and its number of cylinders.
+    DiskPolicy disk_policy_ = DISK_FCFS;
+    unsigned int cylinders_ = 200;
+    // Whether each disk is served by its own thread, and how long a request takes.
+    bool threaded_disks_ = false;
+    unsigned int disk_service_us_ = 0;
+    // Whether the memory is compacted, and above which external fragmentation (percent).
+    bool compaction_ = false;
+    unsigned int compact_above_ = 100;
+    // The histograms and counters behind 'S s'.
+    Metrics metrics_;
+    // The event engine's clock, in microseconds, once it drives the system.
+    bool external_clock_ = false;
+    unsigned long long clock_ = 0;
+    // Where the system reports every event; cout, or silent_ to drop them.
+    ostream* output_ = &cout;
+    ostream silent_{nullptr};
+    // Snapshots are formatted here, then written to the output.
+    SnapshotWriter snapshot_{&cout};
+    // The number of snapshots written as JSON lines, and the records of the last ones.
+    unsigned long long snapshots_ = 0;
+    JSONSnapshot ready_json_{"ready", "pid"};
+    JSONSnapshot disk_json_{"disk", "disk"};
+    JSONSnapshot request_json_{"io", "pid"};
+    JSONSnapshot memory_json_{"memory", "start"};
+    JSONSnapshot frame_json_{"frame", "frame"};
+    // The disk threads; declared last so they stop before anything else is destroyed.
+    DiskWorkers disk_workers_;
 
 
 };
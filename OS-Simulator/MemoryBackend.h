@@ -0,0 +1,78 @@
+/*
+  Title          : MemoryBackend.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "MemoryBackend" class
+  Purpose        : Class project
+*/
+#ifndef __MEMORY_BACKEND_H__
+#define __MEMORY_BACKEND_H__
+
+#include <string>
+
+#include "PCB.h"
+#include "Snapshot.h"
+
+using namespace std;
+
+// How the System allocates the memory of its processes: the contiguous
+// best fit "Memory", or the binary buddy system "BuddyMemory".
+class MemoryBackend{
+public:
+    virtual ~MemoryBackend() = default;
+
+    // Gets the name of the allocator, as given on the command line.
+    virtual const char* name() = 0;
+
+    // Sets up the initial memory after user input.
+    // param mem: The memory size in bytes.
+    virtual void setupMemory(const unsigned int &mem) = 0;
+
+    // Allocates the memory needed for a process.
+    // return: True if memory allocated successfully. Otherwise false.
+    virtual bool allocate(PCB* owner) = 0;
+
+    // Deallocates the memory of a process.
+    virtual void deallocate(PCB* owner) = 0;
+
+    // Gets the bytes that are not allocated.
+    virtual unsigned long long getFreeBytes() = 0;
+
+    // Gets the largest block of memory that can be allocated in one piece.
+    virtual unsigned int getLargestHole() = 0;
+
+    // Gets the bytes allocated to processes beyond what they asked for.
+    virtual unsigned long long getInternalFragmentation() = 0;
+
+    // Moves the processes so the free memory is in as few pieces as possible.
+    // return: The bytes moved.
+    virtual unsigned long long compact() = 0;
+
+    // Gets the largest block of memory compact() would leave, without moving anything.
+    virtual unsigned long long getCompactedLargestHole() = 0;
+
+    // Tells whether a process would get its memory once the memory is compacted.
+    // param bytes: The memory the process asks for.
+    bool canFitAfterCompaction(const unsigned int &bytes){
+        return getCompactedLargestHole() >= bytes;
+    }
+
+    // Writes a snapshot of the current memory.
+    virtual void writeMemory(SnapshotWriter &out) = 0;
+
+    // Writes every block of the memory as a JSON lines record, keyed by its
+    // start address. A free block has a null PID.
+    virtual void writeJSON(JSONSnapshot &fragments) = 0;
+
+    // Gets the counters of the object pools of the allocator.
+    virtual string printPools() = 0;
+
+    // Writes every block and its process, by PID, to a checkpoint.
+    virtual void save(CheckpointWriter &out) = 0;
+
+    // Replaces the memory with the one save wrote.
+    // param table: Where the processes are found by PID.
+    virtual void load(CheckpointReader &in, ProcessTable &table) = 0;
+};
+
+#endif
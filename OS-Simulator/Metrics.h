@@ -0,0 +1,368 @@
+/*
+  Title          : Metrics.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "Histogram" and "Metrics" classes
+  Purpose        : Class project
+*/
+#ifndef __METRICS_H__
+#define __METRICS_H__
+
+#include <algorithm>
+#include <vector>
+
+#include "Checkpoint.h"
+#include "Snapshot.h"
+
+using namespace std;
+
+/*
+Log-linear histogram::
+
+A latency can be anything from 0 to billions, so a histogram with one bucket
+per value is too big and one with evenly spaced buckets is too coarse at
+the low end. A log-linear histogram gives every value below 16 its own
+bucket, then splits every power of two into 16 buckets of equal width:
+16, 17, ..., 31 are one wide, 32-33, ..., 62-63 two wide, 64-67 four wide,
+and so on. A bucket is never wider than 1/16 of the values in it, so a
+percentile read from the buckets is within 6.25% of the real one.
+
+The bucket of a value is its highest set bit and the 4 bits after it, so
+recording a value is a count-leading-zeros, a shift and an increment into
+a fixed array; it never allocates.
+*/
+class Histogram{
+public:
+    // Adds a value to the histogram.
+    void record(const unsigned long long &value){
+        counts_[bucket(value)]++;
+        if (count_ == 0 || value < min_){
+            min_ = value;
+        }
+        if (value > max_){
+            max_ = value;
+        }
+        count_++;
+        sum_ += value;
+    }
+
+    unsigned long long count(){ return count_; }
+
+    double mean(){ return count_ > 0 ? (double)sum_ / count_ : 0; }
+
+    // Gets the value a fraction of the recorded values are not above.
+    // param fraction: From 0 to 1, e.g. 0.99 for the 99th percentile.
+    // return: The highest value of the bucket the percentile falls in,
+    //         but not above the largest value recorded.
+    unsigned long long percentile(const double &fraction){
+        if (count_ == 0){
+            return 0;
+        }
+        unsigned long long rank = (unsigned long long)(fraction * count_);
+        rank = rank < 1 ? 1 : (rank > count_ ? count_ : rank);
+        unsigned long long seen = 0;
+        for (int index = 0; index < BUCKETS; index++){
+            seen += counts_[index];
+            if (seen >= rank){
+                unsigned long long highest = index + 1 < BUCKETS ? lowest(index + 1) - 1 : max_;
+                return highest < max_ ? highest : max_;
+            }
+        }
+        return max_;
+    }
+
+    // Writes the count, mean and percentiles of the histogram on one line.
+    void write(SnapshotWriter &out){
+        out << "n " << count_ << "\tmean " << mean() << "\tmin " << min_ << "\tp50 " << percentile(0.5)
+            << "\tp90 " << percentile(0.9) << "\tp99 " << percentile(0.99) << "\tmax " << max_ << '\n';
+    }
+
+private:
+    static const int SUB_BITS = 4;
+    static const int BUCKETS = (64 - SUB_BITS + 1) << SUB_BITS;
+
+    unsigned long long counts_[BUCKETS] = {};
+    unsigned long long count_ = 0;
+    unsigned long long sum_ = 0;
+    unsigned long long min_ = 0;
+    unsigned long long max_ = 0;
+
+    static int bucket(const unsigned long long &value){
+        if (value < (1ULL << SUB_BITS)){
+            return (int)value;
+        }
+        int bit = 63 - __builtin_clzll(value);
+        return ((bit - SUB_BITS + 1) << SUB_BITS) + (int)((value >> (bit - SUB_BITS)) & ((1 << SUB_BITS) - 1));
+    }
+
+    // The smallest value of a bucket.
+    static unsigned long long lowest(const int &index){
+        if (index < (1 << SUB_BITS)){
+            return index;
+        }
+        int bit = (index >> SUB_BITS) + SUB_BITS - 1;
+        return ((1ULL << SUB_BITS) + (index & ((1 << SUB_BITS) - 1))) << (bit - SUB_BITS);
+    }
+};
+
+/*
+Metrics::
+
+The System reports every transition of a process here: it arrives, enters
+the ready queue, gets the CPU, waits for a disk, comes back, terminates.
+Each one is stamped with two clocks: the number of events (commands) the
+system has handled, and the virtual time (the quanta spent in CPU, or the
+microseconds of the event engine). When a process leaves a state, the
+time it spent there goes into a histogram:
+
+  turnaround      from arrival to termination.
+  ready wait      each stay in the ready queue, until the CPU.
+  I/O wait        each disk request, from asking to the interrupt.
+
+The CPU utilization is counted per core: the share of the events, and of
+the virtual time, each core was running a process. The utilization of the
+whole CPU is their mean.
+
+Memory is sampled after every allocation and release: the external
+fragmentation is the share of the free memory that is not in the largest
+hole, the memory a process of that size could not get.
+*/
+class Metrics{
+public:
+    // Sets the number of CPU cores, before anything is counted.
+    void setCores(const int &cores){
+        core_events_.assign(cores, 0);
+        core_time_.assign(cores, 0);
+    }
+
+    // Moves the virtual clock.
+    // param now: The virtual time.
+    // param busy: Bit k is set if core k was in use since the clock last moved.
+    void advance(const unsigned long long &now, const unsigned long long &busy){
+        unsigned long long passed = now - time_;
+        for (unsigned long long cores = busy; cores != 0; cores &= cores - 1){
+            core_time_[__builtin_ctzll(cores)] += passed;
+        }
+        busy_time_ += passed * __builtin_popcountll(busy);
+        time_ = now;
+    }
+
+    // Counts one event and moves the virtual clock to it.
+    void event(const unsigned long long &now, const unsigned long long &busy){
+        advance(now, busy);
+        for (unsigned long long cores = busy; cores != 0; cores &= cores - 1){
+            core_events_[__builtin_ctzll(cores)]++;
+        }
+        busy_events_ += __builtin_popcountll(busy);
+        events_++;
+    }
+
+    // A process was created.
+    void arrived(const int &pid){
+        if ((size_t)pid >= arrival_.size()){
+            size_t size = max((size_t)pid + 1, arrival_.size() * 2);
+            arrival_.resize(size);
+            since_.resize(size);
+        }
+        arrival_[pid] = Stamp{events_, time_};
+        since_[pid] = arrival_[pid];
+    }
+
+    // A process was not created, for lack of memory.
+    void rejected(){ rejected_++; }
+
+    // A process entered the ready queue.
+    void readied(const int &pid){ since_[pid] = Stamp{events_, time_}; }
+
+    // A process left the ready queue for the CPU.
+    void dispatched(const int &pid){
+        ready_wait_events_.record(events_ - since_[pid].event_);
+        ready_wait_time_.record(time_ - since_[pid].time_);
+    }
+
+    // A process in CPU asked for a disk.
+    void blocked(const int &pid){ since_[pid] = Stamp{events_, time_}; }
+
+    // The disk request of a process finished.
+    void unblocked(const int &pid){
+        io_wait_events_.record(events_ - since_[pid].event_);
+        io_wait_time_.record(time_ - since_[pid].time_);
+    }
+
+    // A process terminated.
+    void terminated(const int &pid){
+        turnaround_events_.record(events_ - arrival_[pid].event_);
+        turnaround_time_.record(time_ - arrival_[pid].time_);
+    }
+
+    // A process that became ready took the CPU from the running one.
+    void preempted(){ preemptions_++; }
+
+    // A process moved to the ready queue or CPU of another core.
+    void migrated(){ migrations_++; }
+
+    // The memory was compacted.
+    // param moved: The bytes copied.
+    void compacted(const unsigned long long &moved){
+        compactions_++;
+        moved_ += moved;
+    }
+
+    // Samples the memory after it changed.
+    // param free: The bytes in holes.
+    // param largest: The bytes of the largest hole.
+    // param internal: The bytes allocated beyond what the processes asked for.
+    void memory(const unsigned long long &free, const unsigned long long &largest,
+                const unsigned long long &internal){
+        setMemory(free, largest, internal);
+        fragmentation_.record(fragmentation());
+    }
+
+    // Sets the memory reported, without sampling it, when the memory was set
+    // up or restored rather than changed.
+    void setMemory(const unsigned long long &free, const unsigned long long &largest,
+                   const unsigned long long &internal){
+        free_ = free;
+        largest_hole_ = largest;
+        internal_ = internal;
+    }
+
+    unsigned long long getRejected(){ return rejected_; }
+    unsigned long long getMigrations(){ return migrations_; }
+
+    // Gets the share of the events the cores were in use, in percent.
+    double getUtilization(){ return percent(busy_events_, events_ * core_events_.size()); }
+
+    // Gets the turnaround and ready wait of the processes, in virtual time.
+    Histogram& getTurnaround(){ return turnaround_time_; }
+    Histogram& getReadyWait(){ return ready_wait_time_; }
+
+    // Gets the external fragmentation, in tenths of a percent.
+    unsigned long long fragmentation(){
+        return free_ > 0 ? 1000 - largest_hole_ * 1000 / free_ : 0;
+    }
+
+    // Writes every metric.
+    // param unit: The unit of the virtual time.
+    void write(SnapshotWriter &out, const char* unit){
+        out << " ===================================\n";
+        out << "|          M E T R I C S            |\n";
+        out << " ===================================\n\n";
+        out << "\tEvents >> " << events_ << "\tVirtual time >> " << time_ << " " << unit << '\n';
+        size_t cores = core_events_.size();
+        out << "\tCPU utilization >> " << percent(busy_events_, events_ * cores) << "% of events, "
+            << percent(busy_time_, time_ * cores) << "% of time\n";
+        if (cores > 1){
+            for (size_t core = 0; core < cores; core++){
+                out << "\t  Core " << core << " >> " << percent(core_events_[core], events_) << "% of events, "
+                    << percent(core_time_[core], time_) << "% of time\n";
+            }
+            out << "\tMigrations >> " << migrations_ << '\n';
+        }
+        out << "\tPreemptions >> " << preemptions_ << "\tRejected >> " << rejected_ << "\n\n";
+        out << "\tTurnaround (events)\t";
+        turnaround_events_.write(out);
+        out << "\tTurnaround (" << unit << ")\t";
+        turnaround_time_.write(out);
+        out << "\tReady wait (events)\t";
+        ready_wait_events_.write(out);
+        out << "\tReady wait (" << unit << ")\t";
+        ready_wait_time_.write(out);
+        out << "\tI/O wait (events)\t";
+        io_wait_events_.write(out);
+        out << "\tI/O wait (" << unit << ")\t";
+        io_wait_time_.write(out);
+        out << "\n\tExternal fragmentation >> " << fragmentation() / 10.0 << "%\tLargest hole >> "
+            << largest_hole_ << " of " << free_ << " bytes free\n";
+        out << "\tInternal fragmentation >> " << internal_ << " bytes\n";
+        out << "\tCompactions >> " << compactions_ << "\tBytes moved >> " << moved_ << '\n';
+        out << "\tFragmentation (0.1%)\t";
+        fragmentation_.write(out);
+    }
+
+    // Writes every counter and histogram to a checkpoint.
+    void save(CheckpointWriter &out){
+        unsigned long long counters[] = {events_, time_, busy_events_, busy_time_, preemptions_, rejected_,
+                                         compactions_, moved_, free_, largest_hole_, internal_, migrations_};
+        out.putArray(counters, sizeof(counters) / sizeof(counters[0]));
+        out.putVector(core_events_);
+        out.putVector(core_time_);
+        out.putVector(arrival_);
+        out.putVector(since_);
+        for (Histogram* histogram: histograms()){
+            out.put(*histogram);
+        }
+    }
+
+    // Replaces every counter and histogram with the ones save wrote.
+    void load(CheckpointReader &in){
+        unsigned long long counters[12];
+        if (!in.getArray(counters, 12)){
+            return;
+        }
+        events_ = counters[0];
+        time_ = counters[1];
+        busy_events_ = counters[2];
+        busy_time_ = counters[3];
+        preemptions_ = counters[4];
+        rejected_ = counters[5];
+        compactions_ = counters[6];
+        moved_ = counters[7];
+        free_ = counters[8];
+        largest_hole_ = counters[9];
+        internal_ = counters[10];
+        migrations_ = counters[11];
+        core_events_ = in.getVector<unsigned long long>();
+        core_time_ = in.getVector<unsigned long long>();
+        arrival_ = in.getVector<Stamp>();
+        since_ = in.getVector<Stamp>();
+        for (Histogram* histogram: histograms()){
+            *histogram = in.get<Histogram>();
+        }
+    }
+
+private:
+    // When something happened, on both clocks.
+    struct Stamp{
+        unsigned long long event_;
+        unsigned long long time_;
+    };
+
+    unsigned long long events_ = 0;
+    unsigned long long time_ = 0;
+    unsigned long long busy_events_ = 0;
+    unsigned long long busy_time_ = 0;
+    unsigned long long preemptions_ = 0;
+    unsigned long long migrations_ = 0;
+    unsigned long long rejected_ = 0;
+    unsigned long long compactions_ = 0;
+    unsigned long long moved_ = 0;
+    unsigned long long free_ = 0;
+    unsigned long long largest_hole_ = 0;
+    unsigned long long internal_ = 0;
+    // By core: the events and time it was in use.
+    vector<unsigned long long> core_events_ = vector<unsigned long long>(1, 0);
+    vector<unsigned long long> core_time_ = vector<unsigned long long>(1, 0);
+    // By PID: when the process arrived, and when it entered its current state.
+    vector<Stamp> arrival_;
+    vector<Stamp> since_;
+
+    Histogram turnaround_events_;
+    Histogram turnaround_time_;
+    Histogram ready_wait_events_;
+    Histogram ready_wait_time_;
+    Histogram io_wait_events_;
+    Histogram io_wait_time_;
+    Histogram fragmentation_;
+
+    vector<Histogram*> histograms(){
+        return {&turnaround_events_, &turnaround_time_, &ready_wait_events_, &ready_wait_time_,
+                &io_wait_events_, &io_wait_time_, &fragmentation_};
+    }
+
+    static double percent(const unsigned long long &part, const unsigned long long &whole){
+        return whole > 0 ? 100.0 * part / whole : 0;
+    }
+};
+
+#endif
@@ -37,77 +37,190 @@ Accounting Information: Includes the amount of CPU used for process execution, t
 I/O Status Information: Includes a list of I/O devices allocated to the process.
 */
 
-#include <iostream>
-#include <sstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "PageTable.h"
+#include "ProcessTable.h"
+#include "Snapshot.h"
 
 using namespace std;
 
+struct MemFrag;
+
 class PCB{
 public:
-    //zero parameter constructor
-    PCB(): lock_(false){ state_ = "Ready"; }
-    //destructor
-    ~PCB() = default;
-    //copy constructor
-    PCB(const PCB &rhs) = default;
-    //copy assignment
-    PCB& operator=(const PCB &rhs) = default;
-    //move constructor
-    PCB(PCB && rhs) = default;
-    //move assignment
-    PCB& operator=(PCB &&rhs) = default;
+    //destructor; the PID leaves the process table
+    ~PCB(){ table_->remove(pid_); }
+    //a PCB owns its slot in the process table, so it is never copied
+    PCB(const PCB &rhs) = delete;
+    PCB& operator=(const PCB &rhs) = delete;
 
-    //three parameter constructor
-    PCB(int &pid, int &priority, unsigned int &mem) :
-    pid_{pid}, priority_{priority}, mem_size_{mem}{}
-    PCB(int &&pid, int &&priority, unsigned int &&mem) :
-    pid_{move(pid)}, priority_{move(priority)}, mem_size_{move(mem)}{}
+    //four parameter constructor; the process enters the table as ready
+    PCB(ProcessTable &table, const int &pid, const int &priority, const unsigned int &mem) :
+    pid_{pid}, base_priority_{priority}, mem_size_{mem}, table_{&table}{ table_->add(this, pid_, priority); }
 
 
     //setters
-    void setLock(const bool &in_cpu){
-                    lock_ = in_cpu;
+    void setLock(const bool &in_cpu){
+                    table_->setLock(pid_, in_cpu);
+    }
+    void setState(const ProcessState &state){
+                    table_->setState(pid_, state);
     }
-    void setState(const string &state){
-                    state_ = state;
+    void setPriority(const int &priority){
+                    table_->setPriority(pid_, priority);
     }
     void setMemorySize(unsigned int &mem_size){
                     mem_size_ = mem_size;
-    }
+    }
+    void setBurst(const unsigned long long &burst){
+                    burst_ = burst;
+    }
+    void setDeadline(const unsigned long long &deadline){
+                    deadline_ = deadline;
+    }
+    //the only core the process may run on; -1 for any
+    void setAffinity(const int &core){
+                    affinity_ = core;
+    }
+    //the core whose CPU or ready queue the process is in
+    void setCore(const int &core){
+                    core_ = core;
+    }
+    //the disk request the process is waiting for
+    void setIORequest(const string &file, const unsigned int &cylinder){
+                    io_file_ = file;
+                    io_cylinder_ = cylinder;
+    }
+    //the fragment the contiguous allocator gave the process; nullptr when it holds none
+    void setFragment(MemFrag* fragment){
+                    fragment_ = fragment;
+    }
 
     //getters
     int getPID(){
                     return pid_;
     }
-    bool getLockStatus(){
-                    return lock_;
+    bool getLockStatus(){
+                    return table_->getLock(pid_);
     }
     int getMemorySize(){
                     return mem_size_;
     }
-    string getState(){
-                    return state_;
+    ProcessState getState(){
+                    return table_->getState(pid_);
     }
-    int getPriority(){
-                    return priority_;
+    int getPriority(){
+                    return table_->getPriority(pid_);
+    }
+    //the time quanta the process spent in CPU
+    unsigned int getQuanta(){
+                    return table_->getQuanta(pid_);
+    }
+    //the CPU burst declared when the process arrived, in quanta; 0 if none
+    unsigned long long getBurst(){
+                    return burst_;
+    }
+    //the quantum the process must finish by; 0 if none
+    unsigned long long getDeadline(){
+                    return deadline_;
+    }
+    //the file and cylinder of its last disk request
+    const string& getIOFile(){
+                    return io_file_;
+    }
+    unsigned int getIOCylinder(){
+                    return io_cylinder_;
+    }
+    int getAffinity(){
+                    return affinity_;
+    }
+    //the core the process last ran or waited on; -1 before it got one
+    int getCore(){
+                    return core_;
+    }
+    //the priority the process arrived with
+    int getBasePriority(){
+                    return base_priority_;
+    }
+    PageTable& getPageTable(){
+                    return page_table_;
+    }
+    MemFrag* getFragment(){
+                    return fragment_;
     }
 
-    string getProcessInfo(){
-
-          stringstream ss;
-          ss << "\tPID >> " << pid_ << endl << "\tPriority >> " << priority_ << endl
-          << "\tProcess Size >> " << mem_size_ << endl << "\tState >> " << state_ << endl
-          << "\tUsing CPU >> " << (lock_ == true ? "TRUE\n" : "FALSE\n");
+    // Writes the information of the process.
+    void writeProcessInfo(SnapshotWriter &out){
+          out << "\tPID >> " << pid_ << "\n\tPriority >> " << getPriority()
+          << "\n\tProcess Size >> " << mem_size_ << "\n\tState >> " << stateName(getState())
+          << "\n\tUsing CPU >> " << (getLockStatus() == true ? "TRUE\n" : "FALSE\n");
+    }
 
-         return ss.str();
-}
+    // Writes what the constructor does not take to a checkpoint.
+    void save(CheckpointWriter &out){
+          out.put(getPriority());
+          out.put(getState());
+          out.put(getLockStatus());
+          out.put(burst_);
+          out.put(deadline_);
+          out.put(affinity_);
+          out.put(core_);
+          out.put(io_cylinder_);
+          out.putString(io_file_);
+          table_->save(pid_, out);
+          page_table_.save(out);
+    }
+
+    // Reads back what save wrote.
+    void load(CheckpointReader &in){
+          setPriority(in.get<int>());
+          setState(in.get<ProcessState>());
+          setLock(in.get<bool>());
+          burst_ = in.get<unsigned long long>();
+          deadline_ = in.get<unsigned long long>();
+          affinity_ = in.get<int>();
+          core_ = in.get<int>();
+          io_cylinder_ = in.get<unsigned int>();
+          io_file_ = in.getString();
+          table_->load(pid_, in);
+          page_table_.load(in);
+    }
+
+    // Writes the information of the process as the fields of a JSON object.
+    void writeJSON(SnapshotWriter &out){
+          out << "\"pid\":" << pid_ << ",\"priority\":" << getPriority() << ",\"state\":\""
+          << stateName(getState()) << "\",\"mem\":" << mem_size_ << ",\"cpu\":"
+          << (getLockStatus() == true ? "true" : "false") << ",\"core\":" << core_;
+    }
 
 private:
+    // The ready queue links its processes through the PCB itself.
+    friend class ReadyQueue;
+
     int pid_;
-    int priority_;
+    int base_priority_;
     unsigned int mem_size_;
-    bool lock_;
-    string state_;
+    unsigned long long burst_ = 0;
+    unsigned long long deadline_ = 0;
+    int affinity_ = -1;
+    int core_ = -1;
+    string io_file_;
+    unsigned int io_cylinder_ = 0;
+    // The table holding the state, priority and CPU lock of the process.
+    ProcessTable* table_;
+    // The resident pages of the process.
+    PageTable page_table_;
+    // The fragment of the contiguous allocator the process occupies.
+    MemFrag* fragment_ = nullptr;
+    // Neighbors in the ready queue the process is waiting in.
+    PCB* ready_prev_ = nullptr;
+    PCB* ready_next_ = nullptr;
+    // Neighbors among the processes of that ready queue free to move to another core.
+    PCB* movable_prev_ = nullptr;
+    PCB* movable_next_ = nullptr;
 }
 ;
 #endif
@@ -0,0 +1,110 @@
+/*
+  Title          : PageTable.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "PageTable" class
+  Purpose        : Class project
+*/
+#ifndef __PAGE_TABLE_H__
+#define __PAGE_TABLE_H__
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "Checkpoint.h"
+
+using namespace std;
+
+/*
+Page table::
+
+Every address generated by the CPU is divided into two parts: a page
+number (p) and a page offset (d). The page number is used as an index into
+a page table. The page table contains the base address of each page in
+physical memory.
+
+Only the resident pages of a process have an entry, so the table grows
+with the frames the process holds and not with its logical size.
+*/
+class PageTable{
+public:
+    // Default constructor/destructor.
+    PageTable() = default;
+    ~PageTable() = default;
+
+    // Looks up the frame a page is stored in.
+    // param page: The page number.
+    // param frame: Set to the frame number if the page is resident.
+    // return: True if the page is resident. Otherwise false.
+    bool lookup(const unsigned int &page, unsigned int &frame){
+        auto entry = entries_.find(page);
+        if (entry == entries_.end()){
+            return false;
+        }
+        frame = entry->second;
+        return true;
+    }
+
+    // Records that a page is stored in a frame.
+    // param page: The page number.
+    // param frame: The frame number.
+    void map(const unsigned int &page, const unsigned int &frame){
+        entries_[page] = frame;
+    }
+
+    // Removes the entry of a page that left memory.
+    // param page: The page number.
+    void unmap(const unsigned int &page){
+        entries_.erase(page);
+    }
+
+    // Removes every entry.
+    void clear(){
+        entries_.clear();
+    }
+
+    // Gets the number of resident pages.
+    size_t size(){
+        return entries_.size();
+    }
+
+    // Gets every resident page mapped to its frame.
+    const unordered_map<unsigned int, unsigned int>& entries(){
+        return entries_;
+    }
+
+    // Gets every resident page mapped to its frame, by page number.
+    vector<pair<unsigned int, unsigned int>> sortedEntries(){
+        vector<pair<unsigned int, unsigned int>> sorted(entries_.begin(), entries_.end());
+        sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+
+    // Writes every entry to a checkpoint, as page and frame pairs by page
+    // number, so the file does not depend on the order of the hash table.
+    void save(CheckpointWriter &out){
+        vector<unsigned int> pairs;
+        pairs.reserve(entries_.size() * 2);
+        for (auto &entry: sortedEntries()){
+            pairs.push_back(entry.first);
+            pairs.push_back(entry.second);
+        }
+        out.putVector(pairs);
+    }
+
+    // Replaces every entry with the ones of a checkpoint.
+    void load(CheckpointReader &in){
+        vector<unsigned int> pairs = in.getVector<unsigned int>();
+        entries_.clear();
+        for (size_t i = 0; i + 1 < pairs.size(); i += 2){
+            entries_[pairs[i]] = pairs[i + 1];
+        }
+    }
+
+private:
+    // Page number mapped to frame number.
+    unordered_map<unsigned int, unsigned int> entries_;
+};
+
+#endif
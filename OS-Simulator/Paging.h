@@ -0,0 +1,289 @@
+/*
+  Title          : Paging.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "FrameTable" class
+  Purpose        : Class project
+*/
+#ifndef __PAGING_H__
+#define __PAGING_H__
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "FrameBitmap.h"
+#include "PCB.h"
+using namespace std;
+
+/*
+Paging::
+
+The basic method for implementing paging involves breaking physical memory
+into fixed-sized blocks called frames and breaking logical memory into
+blocks of the same size called pages. When a process is to be executed, its
+pages are loaded into any available memory frames.
+
+LRU page replacement::
+
+LRU replacement associates with each page the time of that page's last use.
+When a page must be replaced, LRU chooses the page that has not been used
+for the longest period of time. The frames are kept on a doubly linked list
+in order of use: a referenced frame moves to the tail, and the victim is
+always the head, so both are O(1).
+
+A frame entry only exists once the frame has been handed out, so a RAM of
+4,000,000,000 bytes costs nothing until its frames are actually used. The
+frames released by terminated processes are a bit vector over the frames
+handed out (see FrameBitmap.h); a page fault takes the lowest of them, then
+a frame never used, and only then evicts a page.
+*/
+
+// Frame is an entry of the frame table.
+struct Frame{
+
+    PCB* owner_;
+    unsigned int page_;
+    // Neighbors on the LRU list, as frame numbers.
+    unsigned int lru_prev_;
+    unsigned int lru_next_;
+
+    Frame(PCB *owner, const unsigned int &page)
+            : owner_{owner}, page_{page}, lru_prev_{0}, lru_next_{0}{}
+};
+
+class FrameTable{
+public:
+    // Marks the end of the LRU list.
+    static const unsigned int NONE = 0xFFFFFFFFu;
+
+    // Default constructor/destructor.
+    FrameTable() = default;
+    ~FrameTable() = default;
+
+    // Sets up the frames after user input.
+    // param mem_size: The size of the RAM in bytes.
+    // param page_size: The size of a page (and frame) in bytes.
+    void setupFrames(const unsigned int &mem_size, const unsigned int &page_size){
+        page_size_ = page_size;
+        num_frames_ = mem_size / page_size;
+        frames_.clear();
+        free_frames_.clear();
+        lru_head_ = lru_tail_ = NONE;
+        used_ = 0;
+    }
+
+    // Gets the size of a page in bytes.
+    unsigned int getPageSize(){
+        return page_size_;
+    }
+
+    // Gets the number of frames in the RAM.
+    unsigned int getFrameCount(){
+        return num_frames_;
+    }
+
+    // References a page of a process, loading it if it is not resident.
+    // param process: The process using the page.
+    // param page: The page number.
+    // param frame: Set to the frame the page is stored in.
+    // return: False on a page fault (the page had to be loaded). Otherwise true.
+    bool reference(PCB* process, const unsigned int &page, unsigned int &frame){
+        evicted_ = false;
+        if (process->getPageTable().lookup(page, frame)){
+            unlink(frame);
+            append(frame);
+            return true;
+        }
+        frame = takeFrame();
+        frames_[frame].owner_ = process;
+        frames_[frame].page_ = page;
+        process->getPageTable().map(page, frame);
+        append(frame);
+        used_++;
+        return false;
+    }
+
+    // Marks a frame as the most recently used.
+    // param frame: The frame number.
+    void touch(const unsigned int &frame){
+        unlink(frame);
+        append(frame);
+    }
+
+    // Tells which page the last reference evicted, if any.
+    // param pid: Set to the PID of the process that lost the page.
+    // param page: Set to the page number that was evicted.
+    // return: True if the last reference evicted a page. Otherwise false.
+    bool evicted(int &pid, unsigned int &page){
+        pid = evicted_pid_;
+        page = evicted_page_;
+        return evicted_;
+    }
+
+    // Releases every frame a process holds, in any order: the next page
+    // fault takes the lowest free frame whichever order they were freed in.
+    // param process: The process leaving memory.
+    void release(PCB* process){
+        for (auto &entry: process->getPageTable().entries()){
+            unlink(entry.second);
+            frames_[entry.second].owner_ = nullptr;
+            free_frames_.release(entry.second);
+            used_--;
+        }
+        process->getPageTable().clear();
+    }
+
+    // Writes a snapshot of the used frames, least recently used first.
+    void writeFrames(SnapshotWriter &out){
+        out << " ===================================\n";
+        out << "|        F R A M E  T A B L E       |\n";
+        out << " ===================================\n\n";
+        out << "\tPage size >> " << page_size_
+            << "\n\tFrames used >> " << used_ << " / " << num_frames_ << "\n\n";
+        if (lru_head_ == NONE){
+            out << "\tNo frames in use\n";
+            return;
+        }
+        for (unsigned int frame = lru_head_; frame != NONE; frame = frames_[frame].lru_next_){
+            out << "\tFrame >> " << frame << "\tPID >> " << frames_[frame].owner_->getPID()
+                << "\tPage >> " << frames_[frame].page_ << '\n';
+        }
+    }
+
+    // Writes the frames to a checkpoint, with each owner as its PID (0 for none).
+    void save(CheckpointWriter &out){
+        out.put(page_size_);
+        out.put(num_frames_);
+        out.put(used_);
+        out.put<unsigned long long>(frames_.size());
+        for (auto &frame: frames_){
+            out.put(frame.owner_ == nullptr ? 0 : frame.owner_->getPID());
+            out.put(frame.page_);
+            out.put(frame.lru_prev_);
+            out.put(frame.lru_next_);
+        }
+        vector<unsigned int> released;
+        for (unsigned int frame = 0; frame < frames_.size(); frame++){
+            if (free_frames_.isFree(frame)){
+                released.push_back(frame);
+            }
+        }
+        out.putVector(released);
+        out.put(lru_head_);
+        out.put(lru_tail_);
+        out.put(evicted_);
+        out.put(evicted_pid_);
+        out.put(evicted_page_);
+    }
+
+    // Replaces the frames with the ones save wrote.
+    // param table: Where the owners are found by PID.
+    void load(CheckpointReader &in, ProcessTable &table){
+        page_size_ = in.get<unsigned int>();
+        num_frames_ = in.get<unsigned int>();
+        used_ = in.get<unsigned int>();
+        frames_.clear();
+        unsigned long long count = in.get<unsigned long long>();
+        for (unsigned long long i = 0; i < count && in.ok(); i++){
+            PCB* owner = table.getProcess(in.get<int>());
+            frames_.push_back(Frame(owner, in.get<unsigned int>()));
+            frames_.back().lru_prev_ = in.get<unsigned int>();
+            frames_.back().lru_next_ = in.get<unsigned int>();
+        }
+        free_frames_.clear();
+        free_frames_.grow(frames_.size());
+        for (auto &frame: in.getVector<unsigned int>()){
+            if (frame < frames_.size()){
+                free_frames_.release(frame);
+            }
+        }
+        lru_head_ = in.get<unsigned int>();
+        lru_tail_ = in.get<unsigned int>();
+        evicted_ = in.get<bool>();
+        evicted_pid_ = in.get<int>();
+        evicted_page_ = in.get<unsigned int>();
+    }
+
+    // Writes every used frame as a JSON lines record, keyed by frame number.
+    void writeJSON(JSONSnapshot &frames){
+        for (unsigned int frame = lru_head_; frame != NONE; frame = frames_[frame].lru_next_){
+            frames.record() << "\"frame\":" << frame << ",\"pid\":" << frames_[frame].owner_->getPID()
+                            << ",\"page\":" << frames_[frame].page_;
+            frames.commit(frame);
+        }
+    }
+
+private:
+    // Size of a page in bytes.
+    unsigned int page_size_ = 4096;
+    // Number of frames in the RAM.
+    unsigned int num_frames_ = 0;
+    // Number of frames holding a page.
+    unsigned int used_ = 0;
+    // Every frame that was ever handed out, indexed by frame number.
+    vector<Frame> frames_;
+    // Frames released by terminated processes, a bit for every frame in frames_.
+    FrameBitmap free_frames_;
+    // Least and most recently used frames.
+    unsigned int lru_head_ = NONE;
+    unsigned int lru_tail_ = NONE;
+    // The page the last reference evicted.
+    bool evicted_ = false;
+    int evicted_pid_ = 0;
+    unsigned int evicted_page_ = 0;
+
+    // Gets a frame for a new page: the lowest released frame, a never used
+    // frame, or the least recently used frame, whose page is taken from its owner.
+    // return: The frame number.
+    unsigned int takeFrame(){
+        unsigned int frame = free_frames_.findFree();
+        if (frame != FrameBitmap::NONE){
+            free_frames_.take(frame);
+            return frame;
+        }
+        if (frames_.size() < num_frames_){
+            frames_.push_back(Frame(nullptr, 0));
+            free_frames_.grow(frames_.size());
+            return frames_.size() - 1;
+        }
+        unsigned int victim = lru_head_;
+        unlink(victim);
+        evicted_ = true;
+        evicted_pid_ = frames_[victim].owner_->getPID();
+        evicted_page_ = frames_[victim].page_;
+        frames_[victim].owner_->getPageTable().unmap(frames_[victim].page_);
+        used_--;
+        return victim;
+    }
+
+    // Adds a frame as the most recently used.
+    void append(const unsigned int &frame){
+        frames_[frame].lru_prev_ = lru_tail_;
+        frames_[frame].lru_next_ = NONE;
+        if (lru_tail_ == NONE){
+            lru_head_ = frame;
+        } else {
+            frames_[lru_tail_].lru_next_ = frame;
+        }
+        lru_tail_ = frame;
+    }
+
+    // Takes a frame off the LRU list.
+    void unlink(const unsigned int &frame){
+        Frame &entry = frames_[frame];
+        if (entry.lru_prev_ == NONE){
+            lru_head_ = entry.lru_next_;
+        } else {
+            frames_[entry.lru_prev_].lru_next_ = entry.lru_next_;
+        }
+        if (entry.lru_next_ == NONE){
+            lru_tail_ = entry.lru_prev_;
+        } else {
+            frames_[entry.lru_next_].lru_prev_ = entry.lru_prev_;
+        }
+    }
+};
+
+#endif
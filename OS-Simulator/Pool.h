@@ -0,0 +1,138 @@
+/*
+  Title          : Pool.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "ObjectPool" class
+  Purpose        : Class project
+*/
+#ifndef __POOL_H__
+#define __POOL_H__
+
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/*
+Slab allocation::
+
+A slab is made up of one or more physically contiguous pages. A cache
+consists of one or more slabs, and there is a single cache for each unique
+kernel data structure. When an object is freed it is marked free and
+returned to its cache, so the next request for that structure reuses it
+without going back to the general purpose allocator.
+
+ObjectPool<T> is that cache for one type: slabs of SLAB_SIZE slots, and a
+stack of free slots, so acquiring and releasing an object are O(1). The pool
+owns every object it handed out; whatever is still live when the pool is
+destroyed is destroyed with it.
+*/
+template <class T>
+class ObjectPool{
+public:
+    // Number of objects in a slab.
+    static const size_t SLAB_SIZE = 1024;
+
+    // Default constructor.
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool &rhs) = delete;
+    ObjectPool& operator=(const ObjectPool &rhs) = delete;
+
+    // Destructor; Destroys every object still live, slab by slab.
+    ~ObjectPool(){
+        for (auto &slab: slabs_){
+            for (size_t i = 0; i < SLAB_SIZE; i++){
+                if (slab[i].live_){
+                    reinterpret_cast<T*>(&slab[i].storage_)->~T();
+                }
+            }
+        }
+    }
+
+    // Constructs an object in a free slot.
+    // param args: The arguments of the constructor of T.
+    // return: A pointer to the object.
+    template <class... Args>
+    T* acquire(Args&&... args){
+        Slot* slot;
+        if (free_.empty()){
+            if (next_ == SLAB_SIZE || slabs_.empty()){
+                slabs_.push_back(unique_ptr<Slot[]>(new Slot[SLAB_SIZE]));
+                next_ = 0;
+            }
+            slot = &slabs_.back()[next_++];
+        } else {
+            slot = free_.back();
+            free_.pop_back();
+            recycled_++;
+        }
+        T* object = new (&slot->storage_) T(forward<Args>(args)...);
+        slot->live_ = true;
+        live_++;
+        return object;
+    }
+
+    // Destroys an object and returns its slot to the pool.
+    // param object: A pointer returned by acquire.
+    void release(T* object){
+        if (object == nullptr){
+            return;
+        }
+        object->~T();
+        // storage_ is the first member, so the object and its slot share an address.
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->live_ = false;
+        free_.push_back(slot);
+        live_--;
+    }
+
+    // Gets the number of objects in use.
+    size_t live(){
+        return live_;
+    }
+
+    // Gets the number of acquires served by a released slot.
+    unsigned long long recycled(){
+        return recycled_;
+    }
+
+    // Gets the number of slots in every slab.
+    size_t capacity(){
+        return slabs_.size() * SLAB_SIZE;
+    }
+
+    // Gets the pool counters.
+    // param name: The name of the pooled type.
+    // return: A string of the counters.
+    string printPool(const string &name){
+        stringstream ss;
+        ss << "\t" << name << ":\n"
+           << "\t\tLive >> " << live_ << endl
+           << "\t\tRecycled >> " << recycled_ << endl
+           << "\t\tFree slots >> " << capacity() - live_ << endl
+           << "\t\tSlabs >> " << slabs_.size() << " (" << capacity() << " slots)\n";
+        return ss.str();
+    }
+
+private:
+    struct Slot{
+        typename aligned_storage<sizeof(T), alignof(T)>::type storage_;
+        bool live_ = false;
+    };
+
+    // Every slab; slots are never moved once handed out.
+    vector<unique_ptr<Slot[]>> slabs_;
+    // Next never used slot of the last slab.
+    size_t next_ = 0;
+    // Released slots, reused last in first out.
+    vector<Slot*> free_;
+    size_t live_ = 0;
+    unsigned long long recycled_ = 0;
+};
+
+#endif
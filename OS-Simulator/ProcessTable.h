@@ -0,0 +1,208 @@
+/*
+  Title          : ProcessTable.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "ProcessTable" class
+  Purpose        : Class project
+*/
+#ifndef __PROCESS_TABLE_H__
+#define __PROCESS_TABLE_H__
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Checkpoint.h"
+
+using namespace std;
+
+class PCB;
+
+// The state of a process. TERMINATED marks a PID that left the system.
+enum ProcessState : unsigned char { READY, RUNNING, WAITING, TERMINATED };
+
+// Gets the name of a process state, for printing.
+inline const char* stateName(const ProcessState &state){
+    switch (state){
+        case READY: return "Ready";
+        case RUNNING: return "Running";
+        case WAITING: return "Waiting";
+        default: return "Terminated";
+    }
+}
+
+/*
+Process table::
+
+The operating system keeps every PCB in a process table indexed by PID.
+PIDs start from 1 and are never reused, so the table is dense: slot p
+belongs to PID p for the whole run.
+
+The fields the scheduler reads on every transition (state, priority, and
+whether the process holds the CPU) are stored as one array per field. A
+transition writes one byte, and a snapshot walks the arrays in order
+instead of chasing PCB pointers through the queues.
+*/
+class ProcessTable{
+public:
+    // Default constructor/destructor.
+    ProcessTable() = default;
+    ~ProcessTable() = default;
+    ProcessTable(const ProcessTable &rhs) = delete;
+    ProcessTable& operator=(const ProcessTable &rhs) = delete;
+
+    // Adds a new process to the table, in the ready state.
+    // param process: The PCB of the process.
+    // param pid: The PID of the process.
+    // param priority: The priority of the process.
+    void add(PCB* process, const int &pid, const int &priority){
+        if ((size_t)pid >= pcb_.size()){
+            size_t size = max((size_t)pid + 1, pcb_.size() * 2);
+            pcb_.resize(size, nullptr);
+            state_.resize(size, TERMINATED);
+            priority_.resize(size, 0);
+            lock_.resize(size, 0);
+            quanta_.resize(size, 0);
+            slice_.resize(size, 0);
+            ready_since_.resize(size, 0);
+            waited_.resize(size, 0);
+        }
+        pcb_[pid] = process;
+        state_[pid] = READY;
+        priority_[pid] = priority;
+        lock_[pid] = 0;
+        quanta_[pid] = 0;
+        slice_[pid] = 0;
+        ready_since_[pid] = 0;
+        waited_[pid] = 0;
+        live_++;
+    }
+
+    // Removes a process that left the system. Its PID stays TERMINATED.
+    // param pid: The PID of the process.
+    void remove(const int &pid){
+        pcb_[pid] = nullptr;
+        state_[pid] = TERMINATED;
+        lock_[pid] = 0;
+        live_--;
+    }
+
+    // Gets the PCB of a process.
+    // return: The PCB, or nullptr if the PID is not in the system.
+    PCB* getProcess(const int &pid){
+        return (size_t)pid < pcb_.size() ? pcb_[pid] : nullptr;
+    }
+
+    ProcessState getState(const int &pid){
+        return state_[pid];
+    }
+    void setState(const int &pid, const ProcessState &state){
+        state_[pid] = state;
+    }
+    int getPriority(const int &pid){
+        return priority_[pid];
+    }
+    void setPriority(const int &pid, const int &priority){
+        priority_[pid] = priority;
+    }
+    bool getLock(const int &pid){
+        return lock_[pid] != 0;
+    }
+    void setLock(const int &pid, const bool &in_cpu){
+        lock_[pid] = in_cpu;
+    }
+
+    // Counts one more time quantum spent by a process in CPU.
+    // return: The quanta spent since the process last got its time slice.
+    unsigned int addQuantum(const int &pid){
+        quanta_[pid]++;
+        return ++slice_[pid];
+    }
+    // Gets the quanta a process spent in CPU since it arrived.
+    unsigned int getQuanta(const int &pid){
+        return quanta_[pid];
+    }
+    // Gives a process a new time slice.
+    void resetSlice(const int &pid){
+        slice_[pid] = 0;
+    }
+
+    // A process entered the ready queue.
+    // param now: The quanta the system has run.
+    void startWaiting(const int &pid, const unsigned long long &now){
+        ready_since_[pid] = now;
+    }
+    // A process left the ready queue for the CPU.
+    void stopWaiting(const int &pid, const unsigned long long &now){
+        waited_[pid] += now - ready_since_[pid];
+    }
+    // Gets the quanta a process spent in the ready queue.
+    unsigned long long getWaited(const int &pid){
+        return waited_[pid];
+    }
+
+    // Writes the counters of a process to a checkpoint.
+    void save(const int &pid, CheckpointWriter &out){
+        out.put(quanta_[pid]);
+        out.put(slice_[pid]);
+        out.put(ready_since_[pid]);
+        out.put(waited_[pid]);
+    }
+
+    // Reads back the counters save wrote.
+    void load(const int &pid, CheckpointReader &in){
+        quanta_[pid] = in.get<unsigned int>();
+        slice_[pid] = in.get<unsigned int>();
+        ready_since_[pid] = in.get<unsigned long long>();
+        waited_[pid] = in.get<unsigned long long>();
+    }
+
+    // Gets one more than the highest PID the table has a slot for.
+    size_t slots(){
+        return pcb_.size();
+    }
+
+    // Gets the number of processes in the system.
+    size_t live(){
+        return live_;
+    }
+
+    // Gets a summary of every process in the system, by PID.
+    // return: A string of the process table snapshot.
+    string printTable(){
+        stringstream ss;
+        size_t count[TERMINATED] = {0, 0, 0};
+        ss << " ===================================\n";
+        ss << "|     P R O C E S S  T A B L E      |\n";
+        ss << " ===================================\n\n";
+        for (size_t pid = 0; pid < state_.size(); pid++){
+            if (state_[pid] == TERMINATED){
+                continue;
+            }
+            count[state_[pid]]++;
+            ss << "\tPID >> " << pid << "\tPriority >> " << priority_[pid]
+               << "\tState >> " << stateName(state_[pid]) << "\tQuanta >> " << quanta_[pid] << endl;
+        }
+        ss << endl << "\tLive >> " << live_ << " (" << count[READY] << " ready, " << count[RUNNING]
+           << " running, " << count[WAITING] << " waiting)\n";
+        return ss.str();
+    }
+
+private:
+    // One slot per PID.
+    vector<PCB*> pcb_;
+    vector<ProcessState> state_;
+    vector<int> priority_;
+    // A byte per process; a vector<bool> would pack them into shared words.
+    vector<unsigned char> lock_;
+    // Quanta spent in CPU in total, and in the current time slice.
+    vector<unsigned int> quanta_;
+    vector<unsigned int> slice_;
+    // When each process last entered the ready queue, and the quanta it waited there in total.
+    vector<unsigned long long> ready_since_;
+    vector<unsigned long long> waited_;
+    size_t live_ = 0;
+};
+
+#endif
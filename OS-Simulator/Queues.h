@@ -12,9 +12,12 @@
 #include <iostream>
 #include <unordered_map>
 #include <list>
-#include <sstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
-#include "PCB.h"
+#include "Scheduler.h"
 
 using namespace std;
 /*
@@ -41,139 +44,322 @@ example, at completion of I/O)
 */
 
 
-//First come first serve (FCFS)
-class ReadyQueue{
-
-public:
-    // Default constructor/destructors.
-    ReadyQueue() = default;
-    ~ReadyQueue() = default;
-
-    // Adds a process to the priority queue.
-    // param process: The pointer of the process that is being added.
-    void addProcess(PCB* process){
-       readyQueue.push_back(process);
+/*
+Disk scheduling::
+
+The process at the head of a disk queue is using the disk; the others wait.
+When the disk finishes a request it picks the next one by the cylinder each
+request is for and where its head is:
+
+  FCFS   in the order the requests arrived.
+  SSTF   shortest seek time first: the request closest to the head.
+  SCAN   the elevator: the head sweeps toward one end of the disk serving
+         every request on the way, then turns around.
+  C-LOOK the head only serves on its way up; past the last request it
+         jumps back to the lowest one.
+
+The waiting requests are kept ordered by cylinder, so picking the next one
+is O(log n). Every disk counts the cylinders its head moved.
+*/
+enum DiskPolicy : unsigned char { DISK_FCFS, DISK_SSTF, DISK_SCAN, DISK_CLOOK };
+
+// Gets the name of a disk scheduling policy, for printing.
+inline const char* diskPolicyName(const DiskPolicy &policy){
+    switch (policy){
+        case DISK_SSTF: return "SSTF";
+        case DISK_SCAN: return "SCAN";
+        case DISK_CLOOK: return "C-LOOK";
+        default: return "FCFS";
     }
+}
 
-    // Removes the first process from the priority queue.
-    void removeProcess(){
-        readyQueue.pop_front();
+// Gets a disk scheduling policy by the name given on the command line.
+// param name: fcfs, sstf, scan or clook.
+// param policy: Set to the policy.
+// return: False if there is no policy by that name. Otherwise true.
+inline bool parseDiskPolicy(const string &name, DiskPolicy &policy){
+    if (name == "fcfs"){
+        policy = DISK_FCFS;
+    } else if (name == "sstf"){
+        policy = DISK_SSTF;
+    } else if (name == "scan"){
+        policy = DISK_SCAN;
+    } else if (name == "clook"){
+        policy = DISK_CLOOK;
+    } else {
+        return false;
     }
+    return true;
+}
 
-    // Gets the first process from the priority queue.
-    // return: The pointer to the first process in the queue.
-    PCB* getProcess(){
-        return readyQueue.front();
-    }
+class IOQueue{
 
-    // Checks to see if the priority queue is empty.
-    // True if empty. False otherwise.
-    bool empty(){
-        return readyQueue.empty();
+ public:
+    // A first come first served queue, as used by the printers.
+    IOQueue() = default;
+
+    // param policy: How the disk picks its next request.
+    // param cylinders: The number of cylinders of the disk.
+    IOQueue(const DiskPolicy &policy, const unsigned int &cylinders) : policy_{policy}, cylinders_{cylinders}{}
+
+    // Adds a process to the IO queue. An idle device serves it at once.
+    // param process: The pointer of the process to add to the IO queue.
+    void addProcess(PCB* process){
+        if (current_ == nullptr){
+            start(process, 0);
+        } else if (policy_ == DISK_FCFS){
+            ioQueue.push_back(process);
+        } else {
+            waiting_.insert(make_pair(process->getIOCylinder(), process));
+        }
     }
 
-    // Shows the information of all the processes currently in the queue.
-    // return: A string of the information.
-    string showAllProcesses(){
-           stringstream ss;
+    // Removes the process using the device, which then serves the next one.
+    void removeProcess(){
+        current_ = nullptr;
+        unsigned long long travel = 0;
+        PCB* next = pickNext(travel);
+        if (next != nullptr){
+            start(next, travel);
+        }
+    }
 
-           if (readyQueue.empty()){
-                ss << "\tReadyQueue is empty!\n";
-                return ss.str();
-           }
+    // Gets the process using the device.
+    // return: A pointer to the process, or nullptr if the device is idle.
+    PCB* getProcess(){ return current_; }
 
-           for(auto &process: readyQueue){
-                 ss << process->getProcessInfo() << endl;
-           }
-                return ss.str();
-  }
+    // Checks to see if the IO queue is empty.
+    // True if empty. False otherwise.
+    bool isEmpty(){ return current_ == nullptr; }
 
- private:
+    // Gets the cylinder the head is on.
+    unsigned int getHead(){ return head_; }
 
-    // A list of all the process pointers in the queue.
-    list<PCB*> readyQueue;
-};
-
-//First come first serve (FCFS)
-class IOQueue{
+    // Gets the cylinders the head moved to reach the request being served.
+    unsigned long long getLastSeek(){ return last_seek_; }
 
- public:
-    // Adds a process to the IO queue.
-    // param process: The pointer of the process to add to the IO queue.
-    void addProcess(PCB* process){ ioQueue.push_back(process); }
+    // Gets the cylinders the head moved in total.
+    unsigned long long getTotalSeek(){ return total_seek_; }
 
-    // Removes the first process from the IO queue.
-    void removeProcess(){ ioQueue.pop_front(); }
+    // Writes the information of all the processes currently in the queue.
+    void writeAllProcesses(SnapshotWriter &out){
+        if (current_ == nullptr){
+            out << "\tQueue is empty!\n";
+            return;
+        }
 
-    // Gets the first process from the IO queue.
-    // return: A pointer to the first process in the queue.
-    PCB* getProcess(){ return ioQueue.front(); }
+        out << "\tUSING DEVICE: \n\n";
+        writeRequest(out, current_);
+        out << "\t---------------------------\n";
+        if(ioQueue.empty() && waiting_.empty()){
+            out <<"\t    No Process Waiting \n";
+        } else {
+            out << "\t   Processes Waiting\n";
+        }
+        out << "\t---------------------------\n";
+        for(auto &process: ioQueue){
+            writeRequest(out, process);
+        }
+        for(auto &request: waiting_){
+            writeRequest(out, request.second);
+        }
+    }
 
+    // Writes the head and seek statistics of the device.
+    void writeHead(SnapshotWriter &out){
+        out << "\tPolicy >> " << diskPolicyName(policy_) << "\tHead >> " << head_
+            << "\tTotal Seek >> " << total_seek_ << "\tRequests >> " << served_ << '\n';
+    }
 
+    // Writes the requests, by PID, and the head to a checkpoint.
+    void save(CheckpointWriter &out){
+        vector<int> waiting;
+        for (auto &process: ioQueue){
+            waiting.push_back(process->getPID());
+        }
+        for (auto &request: waiting_){
+            waiting.push_back(request.second->getPID());
+        }
+        out.put(current_ == nullptr ? 0 : current_->getPID());
+        out.putVector(waiting);
+        out.put(head_);
+        out.put(moving_up_);
+        out.put(last_seek_);
+        out.put(total_seek_);
+        out.put(served_);
+    }
 
-    // Checks to see if the IO queue is empty.
-    // True if empty. False otherwise.
-    bool isEmpty(){ return ioQueue.empty();}
-
-    // Shows the information of all the processes currently in the queue.
-    // return: A string of the information.
-    string showAllProcesses(){
-        stringstream ss;
-
-        if (ioQueue.empty()){
-
-        ss << "\tQueue is empty!\n";
-        return ss.str();
-       }
-
-       for(auto &process: ioQueue){
-        if (process == ioQueue.front()){
-            ss << "\tUSING DEVICE: \n\n";
-            ss << process->getProcessInfo() << endl;
-            ss << "\t---------------------------\n";
-            if(ioQueue.size() == 1){
-                ss <<"\t    No Process Waiting \n";
+    // Replaces the requests and the head with the ones save wrote.
+    // param table: Where the processes are found by PID.
+    void load(CheckpointReader &in, ProcessTable &table){
+        current_ = table.getProcess(in.get<int>());
+        ioQueue.clear();
+        waiting_.clear();
+        for (auto &pid: in.getVector<int>()){
+            PCB* process = table.getProcess(pid);
+            if (process == nullptr){
+                continue;
+            }
+            if (policy_ == DISK_FCFS){
+                ioQueue.push_back(process);
             } else {
-                ss << "\t   Processes Waiting\n";
+                waiting_.insert(make_pair(process->getIOCylinder(), process));
             }
-            ss << "\t---------------------------\n";
-        }
-        else {
-            ss << process->getProcessInfo() << endl;
         }
-    }
+        head_ = in.get<unsigned int>();
+        moving_up_ = in.get<bool>();
+        last_seek_ = in.get<unsigned long long>();
+        total_seek_ = in.get<unsigned long long>();
+        served_ = in.get<unsigned long long>();
+    }
 
-    return ss.str();
-}
-
+    // Writes the device and its requests as JSON lines records.
+    // param disk: The records of the devices.
+    // param requests: The records of the requests, keyed by PID.
+    // param device_num: The number of the device.
+    void writeJSON(JSONSnapshot &disk, JSONSnapshot &requests, const int &device_num){
+        disk.record() << "\"disk\":" << device_num << ",\"policy\":\"" << diskPolicyName(policy_)
+                      << "\",\"head\":" << head_ << ",\"seek\":" << total_seek_ << ",\"requests\":" << served_;
+        disk.commit(device_num);
+        if (current_ == nullptr){
+            return;
+        }
+        writeRequestJSON(requests, current_, device_num);
+        for(auto &process: ioQueue){
+            writeRequestJSON(requests, process, device_num);
+        }
+        for(auto &request: waiting_){
+            writeRequestJSON(requests, request.second, device_num);
+        }
+    }
 
-private:
-    //list of processes
+private:
+    //list of processes, in arrival order (FCFS)
     list<PCB*> ioQueue;
-};
-
+    // The waiting requests by cylinder, for the other policies.
+    multimap<unsigned int, PCB*> waiting_;
+    // The process using the device.
+    PCB* current_ = nullptr;
+    DiskPolicy policy_ = DISK_FCFS;
+    unsigned int cylinders_ = 1;
+    unsigned int head_ = 0;
+    // Whether a SCAN sweep moves toward the higher cylinders.
+    bool moving_up_ = true;
+    unsigned long long last_seek_ = 0;
+    unsigned long long total_seek_ = 0;
+    unsigned long long served_ = 0;
+
+    // Writes the information of a process and the file and cylinder it asked for.
+    static void writeRequest(SnapshotWriter &out, PCB* process){
+        process->writeProcessInfo(out);
+        out << "\tFile >> " << process->getIOFile() << "\n\tCylinder >> " << process->getIOCylinder() << "\n\n";
+    }
+
+    // Writes a request as a JSON lines record.
+    void writeRequestJSON(JSONSnapshot &requests, PCB* process, const int &device_num){
+        SnapshotWriter &out = requests.record();
+        out << "\"pid\":" << process->getPID() << ",\"disk\":" << device_num << ",\"file\":";
+        out.json(process->getIOFile()) << ",\"cylinder\":" << process->getIOCylinder()
+            << ",\"using\":" << (process == current_ ? "true" : "false");
+        requests.commit(process->getPID());
+    }
+
+    // Starts serving a request, moving the head to its cylinder.
+    // param travel: The cylinders the head already moved on the way, for SCAN.
+    void start(PCB* process, const unsigned long long &travel){
+        unsigned int cylinder = process->getIOCylinder();
+        last_seek_ = travel + (cylinder > head_ ? cylinder - head_ : head_ - cylinder);
+        total_seek_ += last_seek_;
+        head_ = cylinder;
+        current_ = process;
+        served_++;
+    }
+
+    // Takes the next request to serve out of the waiting ones.
+    // param travel: Set to the cylinders a SCAN head moved to the end of the disk.
+    // return: The process of the request, or nullptr if none is waiting.
+    PCB* pickNext(unsigned long long &travel){
+        if (policy_ == DISK_FCFS){
+            if (ioQueue.empty()){
+                return nullptr;
+            }
+            PCB* next = ioQueue.front();
+            ioQueue.pop_front();
+            return next;
+        }
+        if (waiting_.empty()){
+            return nullptr;
+        }
+        //the first request at or above the head
+        auto above = waiting_.lower_bound(head_);
+        auto next = above;
+        if (policy_ == DISK_SSTF){
+            if (above == waiting_.end()
+                || (above != waiting_.begin() && head_ - prev(above)->first <= above->first - head_)){
+                next = prev(above);
+            }
+        } else if (policy_ == DISK_SCAN){
+            if (moving_up_ && above == waiting_.end()){
+                //sweep to the last cylinder, then come back down
+                travel = cylinders_ - 1 - head_;
+                head_ = cylinders_ - 1;
+                moving_up_ = false;
+            } else if (!moving_up_ && waiting_.upper_bound(head_) == waiting_.begin()){
+                //sweep to cylinder 0, then go back up
+                travel = head_;
+                head_ = 0;
+                moving_up_ = true;
+            }
+            next = moving_up_ ? waiting_.lower_bound(head_) : prev(waiting_.upper_bound(head_));
+        } else if (above == waiting_.end()){
+            //C-LOOK: past the last request, jump back to the lowest one
+            next = waiting_.begin();
+        }
+        PCB* process = next->second;
+        waiting_.erase(next);
+        return process;
+    }
+};
+
 class QueueManager{
 public:
     // constructor/destructor
     QueueManager(){
-        ready_queue_.rehash(10);
+        policies_.emplace_back(new PriorityPolicy(5));
+        ready_.assign(1, 0);
+        movable_.assign(1, 0);
         IO_queue.rehash(10);
         disk_queue_.rehash(10);
     }
-    ~QueueManager() = default;
+    ~QueueManager(){ clearIO(); }
+    QueueManager(const QueueManager &rhs) = delete;
+    QueueManager& operator=(const QueueManager &rhs) = delete;
+
+    // The most priority levels the ready queue can have.
+    static const int MAX_PRIORITIES = PriorityPolicy::MAX_PRIORITIES;
 
     // Sets up the ready queues and the IO queues.
     // param num_disks: the number of disks in the system.
     // param IO: the number of printers in the system.
-    void setupQueues(const int &num_disks, const int & numIO){
+    // param num_priorities: the number of priority levels, 0 being the lowest.
+    // param policy: the name of the scheduling policy of the ready queue.
+    // param disk_policy: how every disk picks its next request.
+    // param cylinders: the number of cylinders of every disk.
+    // param num_cores: the number of CPU cores, each with its own ready queue.
+    void setupQueues(const int &num_disks, const int & numIO, const int &num_priorities = 5,
+                     const string &policy = "priority", const DiskPolicy &disk_policy = DISK_FCFS,
+                     const unsigned int &cylinders = 1, const int &num_cores = 1){
 	//creating ready queue
-                    for(int priority_num = 0; priority_num <= 4; priority_num++){
-                        ReadyQueue* new_priority = new ReadyQueue;
-                        pair<int, ReadyQueue*> add_priority_queue (priority_num, new_priority);
-                        ready_queue_.insert(add_priority_queue);
+                    num_priorities_ = num_priorities;
+                    clearIO();
+                    policies_.clear();
+                    for (int core = 0; core < num_cores; core++){
+                        policies_.emplace_back(newSchedulerPolicy(policy, num_priorities));
                     }
+                    ready_.assign(num_cores, 0);
+                    movable_.assign(num_cores, 0);
                     for (int device_num = 0; device_num < num_disks; device_num++){
-                        IOQueue* new_io = new IOQueue;
+                        IOQueue* new_io = new IOQueue(disk_policy, cylinders);
                         pair<int, IOQueue*> add_io_queue (device_num, new_io);
                         disk_queue_.insert(add_io_queue);
                     }
@@ -185,38 +371,144 @@ public:
    }
 
 
-    // Get the ready queue information.
-    // return: A string of all the ready queue information.
-    string printReadyQueue(){
-                    stringstream ss;
-                    for(auto &queue: ready_queue_){
-                        ss << "Priority Queue: " << queue.first << endl << endl;
-                        ss << queue.second->showAllProcesses() << endl;
+    // Writes the ready queue information.
+    // param core: the core of the ready queue.
+    void writeReadyQueue(SnapshotWriter &out, const int &core = 0){
+                    policies_[core]->write(out);
+    }
+
+    // Gets the number of CPU cores.
+    int getCores(){
+                    return policies_.size();
+    }
+
+    // Gets the number of processes in the ready queue of a core.
+    size_t getReadyCount(const int &core){
+                    return ready_[core];
+    }
+
+    // Gets the number of priority levels in the ready queue.
+    int getPriorityLevels(){
+                    return num_priorities_;
+    }
+
+    // Gets the scheduling policy of the ready queue of a core.
+    SchedulerPolicy& getPolicy(const int &core = 0){
+                    return *policies_[core];
+    }
+
+    // Hands a process that last ran on another core to the policy of a core.
+    // param core: the core the process moves to.
+    // return: True if the process came from another core. Otherwise false.
+    bool migrate(PCB* process, const int &core){
+                    int from = process->getCore();
+                    process->setCore(core);
+                    if (from < 0 || from == core){
+                        return false;
                     }
-                    return ss.str();
+                    policies_[core]->migrate(process, *policies_[from]);
+                    return true;
+    }
+
+    /*
+    Work stealing::
+
+    A core whose ready queue is empty takes a process from the ready queue
+    of the busiest other core, the one with the most processes free to move
+    (no affinity). It takes the one that would wait longest there: the last
+    in the order of that core's policy.
+    */
+    // Takes a ready process from the busiest other core for an idle one.
+    // param core: the idle core.
+    // param from: set to the core the process is taken from.
+    // return: The process, removed from its ready queue, or nullptr if no core has one to spare.
+    PCB* steal(const int &core, int &from){
+                    from = -1;
+                    for (int other = 0; other < (int)policies_.size(); other++){
+                        if (other != core && movable_[other] > 0 && (from < 0 || movable_[other] > movable_[from])){
+                            from = other;
+                        }
+                    }
+                    if (from < 0){
+                        return nullptr;
+                    }
+                    PCB* victim = policies_[from]->lastMovable();
+                    removeFromReadyQueue(victim);
+                    migrate(victim, core);
+                    return victim;
     }
 
 
 
-    // Prints I/O queue information
-    // return: A string of all the IO queues information.
-    string printIO_Queue(){
-                    stringstream ss;
-                    ss << " ====================================\n";
-                    ss << "|         D I S K  Q U E U E         |\n";
-                    ss << " ====================================\n\n";
+    // Writes I/O queue information.
+    void writeIO_Queue(SnapshotWriter &out){
+                    out << " ====================================\n";
+                    out << "|         D I S K  Q U E U E         |\n";
+                    out << " ====================================\n\n";
                     for(auto &queue: disk_queue_){
-                        ss << "Disk Number: " << queue.first << endl << endl;
-                        ss << queue.second->showAllProcesses() << endl;
+                        out << "Disk Number: " << queue.first << "\n\n";
+                        queue.second->writeHead(out);
+                        out << '\n';
+                        queue.second->writeAllProcesses(out);
+                        out << '\n';
                     }
-                    return ss.str();
    }
-    // Adds a process to the ready queue.
+
+    // Writes the ready queue of every core, by PID, and every disk and I/O queue to a checkpoint.
+    void save(CheckpointWriter &out){
+                    for (auto &policy: policies_){
+                        vector<int> ready;
+                        policy->visit([&ready](PCB* process){ ready.push_back(process->getPID()); });
+                        policy->save(out);
+                        out.putVector(ready);
+                    }
+                    for (int device_num = 0; device_num < (int)disk_queue_.size(); device_num++){
+                        getDiskQueue(device_num)->save(out);
+                    }
+                    for (int device_num = 0; device_num < (int)IO_queue.size(); device_num++){
+                        getIO_queue(device_num)->save(out);
+                    }
+   }
+
+    // Replaces the queues with the ones save wrote. The queues must have
+    // been set up with as many disks and the same policies.
+    // param table: Where the processes are found by PID.
+    void load(CheckpointReader &in, ProcessTable &table){
+                    for (int core = 0; core < (int)policies_.size(); core++){
+                        policies_[core]->load(in);
+                        for (auto &pid: in.getVector<int>()){
+                            PCB* process = table.getProcess(pid);
+                            if (process != nullptr){
+                                addToReadyQueue(process, core);
+                            }
+                        }
+                    }
+                    for (int device_num = 0; device_num < (int)disk_queue_.size(); device_num++){
+                        getDiskQueue(device_num)->load(in, table);
+                    }
+                    for (int device_num = 0; device_num < (int)IO_queue.size(); device_num++){
+                        getIO_queue(device_num)->load(in, table);
+                    }
+   }
+
+    // Writes every disk and disk request as JSON lines records, by disk number.
+    void writeDiskJSON(JSONSnapshot &disks, JSONSnapshot &requests){
+                    for (int device_num = 0; device_num < (int)disk_queue_.size(); device_num++){
+                        getDiskQueue(device_num)->writeJSON(disks, requests, device_num);
+                    }
+   }
+    // Adds a process to the ready queue of a core.
     // param process: Pointer to the process that is being added.
-    void addToReadyQueue(PCB* process){
+    // param core: The core of the ready queue.
+    void addToReadyQueue(PCB* process, const int &core = 0){
                     process->setLock(false);
-                    process->setState("Ready");
-                    getPriorityQueue(process->getPriority())->addProcess(process);
+                    process->setState(READY);
+                    process->setCore(core);
+                    policies_[core]->add(process);
+                    ready_[core]++;
+                    if (process->getAffinity() < 0){
+                        movable_[core]++;
+                    }
    }
 
     // Adds a process to the disk queue.
@@ -224,7 +516,7 @@ public:
     // param process: The pointer of the process that is being added to the disk queue.
     void addToDiskQueue(const int &device_num, PCB* process){
                     process->setLock(false);
-                    process->setState("Waiting");
+                    process->setState(WAITING);
                     getDiskQueue(device_num)->addProcess(process);
     }
     // Adds a process to the IO queue.
@@ -232,14 +524,19 @@ public:
     // param process: The pointer of the process that is being added to the IO queue.
     void addToIO_Queue(const int &device_num, PCB* process){
                     process->setLock(false);
-                    process->setState("Waiting");
+                    process->setState(WAITING);
                     getIO_queue(device_num)->addProcess(process);
    }
 
-    // Removes the first process in the priority queue.
-    // param priority: Priority of the priority queue to remove from.
-    void removeFromReadyQueue(const int &priority){
-                    getPriorityQueue(priority)->removeProcess();
+    // Removes a specific process from the ready queue of its core.
+    // param process: Pointer to a process waiting in the ready queue.
+    void removeFromReadyQueue(PCB* process){
+                    int core = process->getCore();
+                    policies_[core]->remove(process);
+                    ready_[core]--;
+                    if (process->getAffinity() < 0){
+                        movable_[core]--;
+                    }
     }
 
     // Removes a process from the disk queue.
@@ -256,60 +553,76 @@ public:
 
     // Checks to see if the ready queue is empty
     // return: True if the queue is empty. False otherwise.
-    bool isReadyEmpty(){
-    for(auto & level: ready_queue_){
-        if(!level.second->empty()){
-            return false;
-        }
-    }
-    return true;
+    bool isReadyEmpty(const int &core = 0){
+    return policies_[core]->empty();
 }
 
     // Checks to see if the IO queue is empty.
     // param device_num: The number of the IO queue.
     // return: True if the queue is empty. False otherwise.
-    bool IO_isEmpty(int &device_num){
+    bool IO_isEmpty(const int &device_num){
                     return getIO_queue(device_num)->isEmpty();
     }
 
     // Checks to see if the disk queue is empty.
     // param device_num: The number of the disk queue.
     // return: True if the queue is empty. False otherwise.
-    bool isDiskEmpty(int &device_num){ return getDiskQueue(
+    bool isDiskEmpty(const int &device_num){ return getDiskQueue(
                                                            device_num)->isEmpty();
     }
 
-    // Gets and sets the next process to use the CPU.
+    // Gets and sets the next process to use the CPU of a core.
     // return: The process pointer of the next process in CPU.
-    PCB* getNextProcess(){
-                    for(auto &level: ready_queue_){
-                        if(!level.second->empty()){
-                            return level.second->getProcess();
-                        }
-                    }
-                    //ready queue is empty
-                    return nullptr;
+    PCB* getNextProcess(const int &core = 0){
+                    return policies_[core]->next();
     }
 
     // Gets the next process to use the IO.
     // param device_num: The number of the IO queue.
     // return: The process pointer of the next process in the queue.
-    PCB* getIO_Process(int &device_num){
+    PCB* getIO_Process(const int &device_num){
                     return getIO_queue(device_num)->getProcess();
     }
 
     // Gets the next process to use the disk.
     // param device_num: The number of the disk queue.
     // return: The process pointer of the next process in the queue.
-    PCB* getDiskProcess(int &device_num){
+    PCB* getDiskProcess(const int &device_num){
                     return getDiskQueue(device_num)->getProcess();
+    }
+
+    // Gets the cylinders the head of a disk moved to reach the request it is serving.
+    unsigned long long getDiskLastSeek(const int &device_num){
+                    return getDiskQueue(device_num)->getLastSeek();
+    }
+
+    // Gets the cylinders the head of a disk moved in total.
+    unsigned long long getDiskTotalSeek(const int &device_num){
+                    return getDiskQueue(device_num)->getTotalSeek();
     }
 
 private:
+
+    // Deletes every disk and IO queue.
+    void clearIO(){
+                    for(auto &queue: disk_queue_){
+                        delete queue.second;
+                    }
+                    for(auto &queue: IO_queue){
+                        delete queue.second;
+                    }
+                    disk_queue_.clear();
+                    IO_queue.clear();
+    }
+
+    // The ready queue of every core, ordered by the scheduling policy.
+    vector<unique_ptr<SchedulerPolicy>> policies_;
+    // The processes in the ready queue of every core, and those of them without affinity.
+    vector<size_t> ready_;
+    vector<size_t> movable_;
 
-    // The map of each priority queue in the Ready queue.
-    // Each priority queue is mapped by their priority value.
-    unordered_map<int, ReadyQueue*> ready_queue_;
+    // The number of priority levels.
+    int num_priorities_ = 5;
 
     // The map of each disk queue.
     // Each disk queue is mapped to by their disk number.
@@ -335,12 +648,6 @@ private:
                     return disk_queue_.at(device_num);
     }
 
-    // Gets the pointer to a specific priority queue.
-    // param priority: The number of the priority queue in ready queue.
-    // return: The pointer to the priority queue.
-    ReadyQueue* getPriorityQueue(const int &priority){
-                    return ready_queue_.at(priority);
-    }
 };
 
 #endif
@@ -0,0 +1,528 @@
+/*
+  Title          : Scheduler.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the CPU scheduling policies
+  Purpose        : Class project
+*/
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <functional>
+#include <iostream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "PCB.h"
+
+using namespace std;
+
+//First come first serve (FCFS)
+// An intrusive FIFO: the processes are chained through their own PCBs, so
+// adding, removing and peeking never allocate. A PCB has a second pair of
+// links, so a process can also be in the FIFO of the processes free to move
+// to another core, kept alongside its ready queue.
+class ReadyQueue{
+
+public:
+    // Default constructor/destructors.
+    // param movable: Whether the queue chains its processes through their movable links.
+    explicit ReadyQueue(const bool &movable = false) : movable_{movable}{}
+    ~ReadyQueue() = default;
+
+    // Adds a process to the back of the queue.
+    // param process: The pointer of the process that is being added.
+    void addProcess(PCB* process){
+        prev(process) = tail_;
+        next(process) = nullptr;
+        if (tail_ == nullptr){
+            head_ = process;
+        } else {
+            next(tail_) = process;
+        }
+        tail_ = process;
+        size_++;
+    }
+
+    // Removes the first process from the queue.
+    void removeProcess(){
+        removeProcess(head_);
+    }
+
+    // Removes a process from anywhere in the queue.
+    // param process: The pointer of a process waiting in this queue.
+    void removeProcess(PCB* process){
+        if (prev(process) == nullptr){
+            head_ = next(process);
+        } else {
+            next(prev(process)) = next(process);
+        }
+        if (next(process) == nullptr){
+            tail_ = prev(process);
+        } else {
+            prev(next(process)) = prev(process);
+        }
+        prev(process) = nullptr;
+        next(process) = nullptr;
+        size_--;
+    }
+
+    // Gets the first process from the queue.
+    // return: The pointer to the first process in the queue.
+    PCB* getProcess(){
+        return head_;
+    }
+
+    // Gets the last process from the queue.
+    // return: The pointer to the last process in the queue.
+    PCB* getLast(){
+        return tail_;
+    }
+
+    // Checks to see if the queue is empty.
+    // True if empty. False otherwise.
+    bool empty(){
+        return head_ == nullptr;
+    }
+
+    // Gets the number of processes in the queue.
+    size_t size(){
+        return size_;
+    }
+
+    // Writes the information of all the processes currently in the queue.
+    void writeAllProcesses(SnapshotWriter &out){
+
+           if (empty()){
+                out << "\tReadyQueue is empty!\n";
+                return;
+           }
+
+           for(PCB* process = head_; process != nullptr; process = next(process)){
+                 process->writeProcessInfo(out);
+                 out << '\n';
+           }
+  }
+
+    // Calls a function on every process in the queue, from the first.
+    void visit(const function<void(PCB*)> &call){
+        for (PCB* process = head_; process != nullptr; process = next(process)){
+            call(process);
+        }
+    }
+
+ private:
+    // Whether the processes are chained through their movable links.
+    bool movable_;
+
+    // The first and last process in the queue.
+    PCB* head_ = nullptr;
+    PCB* tail_ = nullptr;
+    // The number of processes in the queue.
+    size_t size_ = 0;
+
+    PCB*& prev(PCB* process){
+        return movable_ ? process->movable_prev_ : process->ready_prev_;
+    }
+
+    PCB*& next(PCB* process){
+        return movable_ ? process->movable_next_ : process->ready_next_;
+    }
+};
+
+/*
+Scheduling policies::
+
+The ready queue orders its processes by the scheduling policy chosen at
+startup. A policy decides three things: which ready process gets the CPU
+next, whether a process that just became ready preempts the running one,
+and whether the running process gives up the CPU after a time quantum.
+
+  priority  preemptive priority, round robin inside a level (the default).
+  fcfs      first come first served; a process runs until it blocks or ends.
+  sjf       shortest job first, by the declared CPU burst or else the memory
+            size; not preemptive.
+  cfs       completely fair: each process gains virtual runtime as it runs,
+            slower the higher its priority, and the CPU goes to the lowest
+            virtual runtime after each quantum.
+  edf       earliest deadline first; an earlier deadline preempts at once,
+            and processes without a deadline come last.
+
+Every dispatch is O(1) (priority, fcfs) or O(log n) (the others, kept in a
+balanced search tree ordered by their key). So is every steal: each policy
+keeps the processes without affinity apart too, in the same order, so the
+last of them is found without walking the ready queue.
+*/
+class SchedulerPolicy{
+public:
+    virtual ~SchedulerPolicy() = default;
+
+    // Gets the name of the policy, as given on the command line.
+    virtual const char* name() = 0;
+
+    // Adds a process to the ready queue.
+    virtual void add(PCB* process) = 0;
+
+    // Removes a process from anywhere in the ready queue.
+    virtual void remove(PCB* process) = 0;
+
+    // Gets the process that should use the CPU next, without removing it.
+    // return: The process, or nullptr if the ready queue is empty.
+    virtual PCB* next() = 0;
+
+    // Checks to see if the ready queue is empty.
+    virtual bool empty() = 0;
+
+    // Gets the process without affinity that would get the CPU last, for
+    // another core to steal, without removing it.
+    // return: The process, or nullptr if every ready process is bound to this core.
+    virtual PCB* lastMovable() = 0;
+
+    // A process arrived or came back from a device; called before preempts.
+    virtual void wake(PCB* process){}
+
+    // A process moves here from the ready queue or CPU of another core;
+    // called before it is added or dispatched.
+    // param from: The policy of the core it leaves, of the same kind as this one.
+    virtual void migrate(PCB* process, SchedulerPolicy &from){}
+
+    // Checks to see if a process that just became ready takes the CPU.
+    // param process: The process that became ready.
+    // param running: The process using the CPU.
+    virtual bool preempts(PCB* process, PCB* running) = 0;
+
+    // The running process spent one time quantum.
+    // param used: The quanta it spent in its current time slice.
+    // param slice: The quanta of a time slice at its priority level.
+    // return: True if it gives up the CPU. Otherwise false.
+    virtual bool expired(PCB* running, const unsigned int &used, const unsigned int &slice) = 0;
+
+    // Writes the ready queue information.
+    virtual void write(SnapshotWriter &out) = 0;
+
+    // Calls a function on every ready process, in the order they get the CPU.
+    virtual void visit(const function<void(PCB*)> &call) = 0;
+
+    // Writes what the policy keeps besides the ready processes to a checkpoint.
+    virtual void save(CheckpointWriter &out){}
+
+    // Reads back what save wrote, before the ready processes are added again.
+    virtual void load(CheckpointReader &in){}
+};
+
+// Preemptive priority, with one FIFO per level. Higher numbers mean higher priority.
+class PriorityPolicy : public SchedulerPolicy{
+public:
+    // The most priority levels the two level bitmap can index.
+    static const int MAX_PRIORITIES = 64 * 64;
+
+    // param num_priorities: The number of priority levels, 0 being the lowest.
+    explicit PriorityPolicy(const int &num_priorities)
+        : ready_queue_(num_priorities), ready_bitmap_((num_priorities + 63) / 64, 0),
+          movable_(num_priorities, ReadyQueue(true)), movable_bitmap_((num_priorities + 63) / 64, 0){}
+
+    const char* name(){ return "priority"; }
+
+    void add(PCB* process){
+        int priority = process->getPriority();
+        ready_queue_[priority].addProcess(process);
+        setBit(ready_bitmap_, ready_summary_, priority);
+        if (process->getAffinity() < 0){
+            movable_[priority].addProcess(process);
+            setBit(movable_bitmap_, movable_summary_, priority);
+        }
+    }
+
+    void remove(PCB* process){
+        int priority = process->getPriority();
+        ready_queue_[priority].removeProcess(process);
+        if (ready_queue_[priority].empty()){
+            clearBit(ready_bitmap_, ready_summary_, priority);
+        }
+        if (process->getAffinity() < 0){
+            movable_[priority].removeProcess(process);
+            if (movable_[priority].empty()){
+                clearBit(movable_bitmap_, movable_summary_, priority);
+            }
+        }
+    }
+
+    // The highest non-empty priority is found with two count-leading-zeros:
+    // one on the summary word, one on the word of levels it points at.
+    PCB* next(){
+        if (ready_summary_ == 0){
+            return nullptr;
+        }
+        int word = 63 - __builtin_clzll(ready_summary_);
+        int bit = 63 - __builtin_clzll(ready_bitmap_[word]);
+        return ready_queue_[(word << 6) | bit].getProcess();
+    }
+
+    bool empty(){
+        return ready_summary_ == 0;
+    }
+
+    // The last movable process of the lowest priority queue that has one,
+    // found with two count-trailing-zeros.
+    PCB* lastMovable(){
+        if (movable_summary_ == 0){
+            return nullptr;
+        }
+        int word = __builtin_ctzll(movable_summary_);
+        int bit = __builtin_ctzll(movable_bitmap_[word]);
+        return movable_[(word << 6) | bit].getLast();
+    }
+
+    bool preempts(PCB* process, PCB* running){
+        return process->getPriority() > running->getPriority();
+    }
+
+    bool expired(PCB* running, const unsigned int &used, const unsigned int &slice){
+        return used >= slice;
+    }
+
+    void write(SnapshotWriter &out){
+        for (int priority = ready_queue_.size() - 1; priority >= 0; priority--){
+            out << "Priority Queue: " << priority << "\n\n";
+            ready_queue_[priority].writeAllProcesses(out);
+            out << '\n';
+        }
+    }
+
+    void visit(const function<void(PCB*)> &call){
+        for (int priority = ready_queue_.size() - 1; priority >= 0; priority--){
+            ready_queue_[priority].visit(call);
+        }
+    }
+
+private:
+    // Each priority queue in the Ready queue, indexed by their priority value.
+    vector<ReadyQueue> ready_queue_;
+
+    // Bit p of ready_bitmap_[w] is set while priority queue 64 * w + p is not
+    // empty, and bit w of ready_summary_ while ready_bitmap_[w] is not zero.
+    vector<unsigned long long> ready_bitmap_;
+    unsigned long long ready_summary_ = 0;
+
+    // The processes of each priority queue without affinity, in the same
+    // order, and the bitmap of the queues that have one.
+    vector<ReadyQueue> movable_;
+    vector<unsigned long long> movable_bitmap_;
+    unsigned long long movable_summary_ = 0;
+
+    // Sets the bitmap bits of a priority queue that is not empty.
+    // param priority: The number of the priority queue in ready queue.
+    static void setBit(vector<unsigned long long> &bitmap, unsigned long long &summary, const int &priority){
+        bitmap[priority >> 6] |= 1ULL << (priority & 63);
+        summary |= 1ULL << (priority >> 6);
+    }
+
+    // Clears the bitmap bits of a priority queue that became empty.
+    // param priority: The number of the priority queue in ready queue.
+    static void clearBit(vector<unsigned long long> &bitmap, unsigned long long &summary, const int &priority){
+        bitmap[priority >> 6] &= ~(1ULL << (priority & 63));
+        if (bitmap[priority >> 6] == 0){
+            summary &= ~(1ULL << (priority >> 6));
+        }
+    }
+};
+
+// First come first served, in a single FIFO.
+class FCFSPolicy : public SchedulerPolicy{
+public:
+    const char* name(){ return "fcfs"; }
+    void add(PCB* process){
+        ready_queue_.addProcess(process);
+        if (process->getAffinity() < 0){
+            movable_.addProcess(process);
+        }
+    }
+    void remove(PCB* process){
+        ready_queue_.removeProcess(process);
+        if (process->getAffinity() < 0){
+            movable_.removeProcess(process);
+        }
+    }
+    PCB* next(){ return ready_queue_.getProcess(); }
+    bool empty(){ return ready_queue_.empty(); }
+    PCB* lastMovable(){ return movable_.getLast(); }
+    bool preempts(PCB* process, PCB* running){ return false; }
+    bool expired(PCB* running, const unsigned int &used, const unsigned int &slice){ return false; }
+
+    void write(SnapshotWriter &out){
+        out << "FCFS Queue:\n\n";
+        ready_queue_.writeAllProcesses(out);
+        out << '\n';
+    }
+
+    void visit(const function<void(PCB*)> &call){ ready_queue_.visit(call); }
+
+private:
+    ReadyQueue ready_queue_;
+    // The processes without affinity, in the same order.
+    ReadyQueue movable_{true};
+};
+
+// A ready queue kept in a balanced search tree ordered by a key of each
+// process, the smallest key first. Ties go to the lower PID, which arrived first.
+// A process keeps its key while it waits, so it can be found to be removed.
+class OrderedPolicy : public SchedulerPolicy{
+public:
+    void add(PCB* process){
+        ready_.insert(make_tuple(key(process), process->getPID(), process));
+        if (process->getAffinity() < 0){
+            movable_.insert(make_tuple(key(process), process->getPID(), process));
+        }
+    }
+    void remove(PCB* process){
+        ready_.erase(make_tuple(key(process), process->getPID(), process));
+        movable_.erase(make_tuple(key(process), process->getPID(), process));
+    }
+    PCB* next(){ return ready_.empty() ? nullptr : get<2>(*ready_.begin()); }
+    bool empty(){ return ready_.empty(); }
+    PCB* lastMovable(){ return movable_.empty() ? nullptr : get<2>(*movable_.rbegin()); }
+
+    void write(SnapshotWriter &out){
+        out << name() << " queue (" << keyName() << " first):\n\n";
+        if (ready_.empty()){
+            out << "\tReadyQueue is empty!\n";
+        }
+        for (auto &entry: ready_){
+            out << "\t" << keyName() << " >> " << get<0>(entry) << '\n';
+            get<2>(entry)->writeProcessInfo(out);
+            out << '\n';
+        }
+    }
+
+    void visit(const function<void(PCB*)> &call){
+        for (auto &entry: ready_){
+            call(get<2>(entry));
+        }
+    }
+
+protected:
+    // Gets the key the policy orders a process by.
+    virtual unsigned long long key(PCB* process) = 0;
+    // Gets the name of the key, for printing.
+    virtual const char* keyName() = 0;
+
+private:
+    set<tuple<unsigned long long, int, PCB*>> ready_;
+    // The processes without affinity, in the same order.
+    set<tuple<unsigned long long, int, PCB*>> movable_;
+};
+
+// Shortest job first, by the declared CPU burst or, without one, the memory size.
+class SJFPolicy : public OrderedPolicy{
+public:
+    const char* name(){ return "sjf"; }
+    bool preempts(PCB* process, PCB* running){ return false; }
+    bool expired(PCB* running, const unsigned int &used, const unsigned int &slice){ return false; }
+
+protected:
+    unsigned long long key(PCB* process){
+        return process->getBurst() > 0 ? process->getBurst() : process->getMemorySize();
+    }
+    const char* keyName(){ return "Job length"; }
+};
+
+// Earliest deadline first. A process without a deadline has the latest one.
+class EDFPolicy : public OrderedPolicy{
+public:
+    const char* name(){ return "edf"; }
+    bool preempts(PCB* process, PCB* running){ return key(process) < key(running); }
+    bool expired(PCB* running, const unsigned int &used, const unsigned int &slice){ return false; }
+
+protected:
+    unsigned long long key(PCB* process){
+        return process->getDeadline() > 0 ? process->getDeadline() : ~0ULL;
+    }
+    const char* keyName(){ return "Deadline"; }
+};
+
+// Completely fair: every quantum in CPU adds to the virtual runtime of a
+// process, less the higher its priority, and the lowest virtual runtime runs.
+class CFSPolicy : public OrderedPolicy{
+public:
+    const char* name(){ return "cfs"; }
+
+    // A process that was away starts from the smallest virtual runtime of the
+    // others, so it cannot take the CPU for as long as it slept.
+    void wake(PCB* process){
+        unsigned long long &runtime = vruntime(process);
+        runtime = max(runtime, min_vruntime_);
+    }
+
+    bool preempts(PCB* process, PCB* running){
+        return vruntime(process) < vruntime(running);
+    }
+
+    // Every core has its own virtual clock, so a process keeps how far it is
+    // ahead of the smallest virtual runtime of the core it leaves.
+    void migrate(PCB* process, SchedulerPolicy &from){
+        CFSPolicy &source = static_cast<CFSPolicy&>(from);
+        unsigned long long runtime = source.vruntime(process);
+        vruntime(process) = min_vruntime_ + (runtime > source.min_vruntime_ ? runtime - source.min_vruntime_ : 0);
+    }
+
+    void save(CheckpointWriter &out){
+        out.putVector(vruntime_);
+        out.put(min_vruntime_);
+    }
+
+    void load(CheckpointReader &in){
+        vruntime_ = in.getVector<unsigned long long>();
+        min_vruntime_ = in.get<unsigned long long>();
+    }
+
+    bool expired(PCB* running, const unsigned int &used, const unsigned int &slice){
+        unsigned long long &runtime = vruntime(running);
+        runtime += QUANTUM_WEIGHT / (running->getPriority() + 1);
+        PCB* waiting = next();
+        min_vruntime_ = max(min_vruntime_, waiting == nullptr ? runtime : min(runtime, vruntime(waiting)));
+        return waiting != nullptr && vruntime(waiting) < runtime;
+    }
+
+protected:
+    unsigned long long key(PCB* process){ return vruntime(process); }
+    const char* keyName(){ return "Virtual runtime"; }
+
+private:
+    // The virtual runtime a quantum adds at priority 0.
+    static const unsigned long long QUANTUM_WEIGHT = 1 << 20;
+    // By PID.
+    vector<unsigned long long> vruntime_;
+    // Never decreases; where waking processes start.
+    unsigned long long min_vruntime_ = 0;
+
+    unsigned long long& vruntime(PCB* process){
+        size_t pid = process->getPID();
+        if (pid >= vruntime_.size()){
+            vruntime_.resize(max(pid + 1, vruntime_.size() * 2), 0);
+        }
+        return vruntime_[pid];
+    }
+};
+
+// Creates a scheduling policy.
+// param name: priority, fcfs, sjf, cfs or edf.
+// param num_priorities: The number of priority levels.
+// return: The policy, or nullptr if there is no policy by that name.
+inline SchedulerPolicy* newSchedulerPolicy(const string &name, const int &num_priorities){
+    if (name == "priority"){
+        return new PriorityPolicy(num_priorities);
+    } else if (name == "fcfs"){
+        return new FCFSPolicy();
+    } else if (name == "sjf"){
+        return new SJFPolicy();
+    } else if (name == "cfs"){
+        return new CFSPolicy();
+    } else if (name == "edf"){
+        return new EDFPolicy();
+    }
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,223 @@
+/*
+  Title          : Snapshot.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "SnapshotWriter" and "JSONSnapshot" classes
+  Purpose        : Class project
+*/
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+using namespace std;
+
+/*
+Snapshots::
+
+A snapshot of a large system has one block of text per process. Building it
+in nested stringstreams allocates a stream per process and copies every
+block several times on its way out. SnapshotWriter formats numbers and text
+straight into one buffer instead, which keeps its capacity from snapshot to
+snapshot, and hands it to the output stream whenever it fills up.
+
+For tools there is a JSON lines format: one object per record (a process, a
+disk, a memory fragment, a frame), each tagged with the kind of snapshot and
+its sequence number. In delta mode only the records that changed since the
+previous snapshot of the same kind are written, and a record that is gone
+is written as its key with "removed":true. Only a 64 bit hash of each record
+is remembered between snapshots.
+*/
+class SnapshotWriter{
+public:
+    // param sink: Where the buffer is written when it fills up; nullptr to
+    //             keep everything in the buffer.
+    // param capacity: The size the buffer is written out at.
+    explicit SnapshotWriter(ostream* sink = nullptr, const size_t &capacity = 1 << 16)
+        : sink_{sink}, capacity_{capacity}{
+        buffer_.reserve(capacity + 256);
+    }
+    SnapshotWriter(const SnapshotWriter &rhs) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter &rhs) = delete;
+
+    SnapshotWriter& operator<<(const char* text){
+        buffer_.append(text);
+        return spill();
+    }
+
+    SnapshotWriter& operator<<(const string &text){
+        buffer_.append(text);
+        return spill();
+    }
+
+    SnapshotWriter& operator<<(const char &c){
+        buffer_.push_back(c);
+        return spill();
+    }
+
+    // Writes an integer without going through a stream.
+    template <class T>
+    typename enable_if<is_integral<T>::value && !is_same<T, bool>::value && !is_same<T, char>::value,
+                       SnapshotWriter&>::type operator<<(const T &value){
+        char digits[24];
+        char* end = digits + sizeof(digits);
+        char* begin = end;
+        unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+        do {
+            *--begin = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0){
+            *--begin = '-';
+        }
+        buffer_.append(begin, end);
+        return spill();
+    }
+
+    // Writes a number the way a stream does by default (6 significant digits).
+    SnapshotWriter& operator<<(const double &value){
+        char digits[32];
+        int length = snprintf(digits, sizeof(digits), "%g", value);
+        buffer_.append(digits, length);
+        return spill();
+    }
+
+    // Writes a string as a quoted JSON string.
+    SnapshotWriter& json(const string &text){
+        buffer_.push_back('"');
+        for (auto &c: text){
+            if (c == '"' || c == '\\'){
+                buffer_.push_back('\\');
+                buffer_.push_back(c);
+            } else if ((unsigned char)c < 0x20){
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+                buffer_.append(escaped);
+            } else {
+                buffer_.push_back(c);
+            }
+        }
+        buffer_.push_back('"');
+        return spill();
+    }
+
+    // Changes where the buffer is written, flushing it first.
+    void setSink(ostream* sink){
+        flush();
+        sink_ = sink;
+    }
+
+    // Writes what is in the buffer to the sink, keeping the buffer's capacity.
+    void flush(){
+        if (sink_ != nullptr && !buffer_.empty()){
+            sink_->write(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+    // Gets what is in the buffer.
+    const string& str(){
+        return buffer_;
+    }
+
+    void clear(){
+        buffer_.clear();
+    }
+
+private:
+    ostream* sink_;
+    size_t capacity_;
+    string buffer_;
+
+    SnapshotWriter& spill(){
+        if (buffer_.size() >= capacity_){
+            flush();
+        }
+        return *this;
+    }
+};
+
+// The JSON lines records of one kind of snapshot, and what they were the
+// last time, for delta mode. A snapshot is written as:
+//
+//   begin(out, sequence, delta);
+//   for every record: fill record() with its fields, then commit(key);
+//   end();
+class JSONSnapshot{
+public:
+    // param kind: The kind of the records, e.g. "ready".
+    // param key_name: The field that identifies a record, e.g. "pid".
+    JSONSnapshot(const char* kind, const char* key_name) : kind_{kind}, key_name_{key_name}{}
+    JSONSnapshot(const JSONSnapshot &rhs) = delete;
+    JSONSnapshot& operator=(const JSONSnapshot &rhs) = delete;
+
+    // Starts a snapshot.
+    // param delta: Write only the records that changed since the last snapshot.
+    void begin(SnapshotWriter &out, const unsigned long long &sequence, const bool &delta){
+        out_ = &out;
+        sequence_ = sequence;
+        delta_ = delta;
+        generation_++;
+    }
+
+    // Gets the buffer to write the fields of the next record into, as
+    // "name":value pairs separated by commas.
+    SnapshotWriter& record(){
+        fields_.clear();
+        return fields_;
+    }
+
+    // Writes the record unless delta mode is on and it did not change.
+    // param key: The value of the key field of the record.
+    void commit(const unsigned long long &key){
+        const string &fields = fields_.str();
+        unsigned long long hash = 14695981039346656037ULL;
+        for (auto &c: fields){
+            hash = (hash ^ (unsigned char)c) * 1099511628211ULL;
+        }
+        Seen &seen = seen_[key];
+        bool changed = seen.generation_ == 0 || seen.hash_ != hash;
+        seen.hash_ = hash;
+        seen.generation_ = generation_;
+        if (!delta_ || changed){
+            *out_ << "{\"snapshot\":\"" << kind_ << "\",\"seq\":" << sequence_ << "," << fields << "}\n";
+        }
+    }
+
+    // Ends a snapshot; in delta mode, writes the records that are gone.
+    void end(){
+        for (auto seen = seen_.begin(); seen != seen_.end();){
+            if (seen->second.generation_ == generation_){
+                ++seen;
+                continue;
+            }
+            if (delta_){
+                *out_ << "{\"snapshot\":\"" << kind_ << "\",\"seq\":" << sequence_ << ",\"" << key_name_
+                      << "\":" << seen->first << ",\"removed\":true}\n";
+            }
+            seen = seen_.erase(seen);
+        }
+    }
+
+private:
+    struct Seen{
+        unsigned long long hash_ = 0;
+        // The snapshot the record was last in; 0 for a new record.
+        unsigned long long generation_ = 0;
+    };
+
+    const char* kind_;
+    const char* key_name_;
+    SnapshotWriter* out_ = nullptr;
+    unsigned long long sequence_ = 0;
+    bool delta_ = false;
+    unsigned long long generation_ = 0;
+    SnapshotWriter fields_;
+    unordered_map<unsigned long long, Seen> seen_;
+};
+
+#endif
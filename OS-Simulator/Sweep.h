@@ -0,0 +1,183 @@
+/*
+  Title          : Sweep.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "Sweep" class
+  Purpose        : Class project
+*/
+#ifndef __SWEEP_H__
+#define __SWEEP_H__
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Memory.h"
+#include "Trace.h"
+
+using namespace std;
+
+/*
+Parameter sweep::
+
+Sizing a machine means replaying the same trace against many systems: every
+memory size, number of disks and cores, and scheduling policy worth trying.
+The runs are independent, so they run in parallel: a pool of threads, one
+per hardware thread, takes the next configuration of the grid until there
+is none left. Every run builds its own System, silenced, and replays the
+one copy of the trace all the threads share, parsed once before the runs
+start; nothing is shared but that trace, which no one writes. A trace with
+checkpoint commands is refused, as every run would write or restore the same
+file. Each run's results are stored at its index in the grid, so the table
+comes out in grid order however the threads finish.
+*/
+// One point of the grid.
+struct SweepConfig{
+    unsigned int mem_size_;
+    int num_disks_;
+    int cores_;
+    string policy_;
+    DiskPolicy disk_policy_;
+    string allocator_;
+};
+
+// What a run reports, read from its System at the end of the trace.
+struct SweepResult{
+    unsigned long long completed_ = 0;
+    unsigned long long rejected_ = 0;
+    unsigned long long ticks_ = 0;
+    double mean_wait_ = 0;
+    double utilization_ = 0;
+    unsigned long long turnaround_p50_ = 0;
+    unsigned long long turnaround_p99_ = 0;
+    unsigned long long fragmentation_ = 0;
+    unsigned long long seek_ = 0;
+    unsigned long long migrations_ = 0;
+};
+
+class Sweep{
+public:
+    // Settings every run of the grid shares.
+    void setPriorityLevels(const int &num_priorities){ num_priorities_ = num_priorities; }
+    void setPageSize(const unsigned int &page_size){ page_size_ = page_size; }
+    void setCylinders(const unsigned int &cylinders){ cylinders_ = cylinders; }
+
+    // Adds every combination of the values to the grid, the memory size
+    // changing slowest and the allocator fastest.
+    void addGrid(const vector<unsigned int> &mem_sizes, const vector<int> &disks, const vector<int> &cores,
+                 const vector<string> &policies, const vector<DiskPolicy> &disk_policies,
+                 const vector<string> &allocators){
+        for (auto &mem_size: mem_sizes)
+        for (auto &num_disks: disks)
+        for (auto &num_cores: cores)
+        for (auto &policy: policies)
+        for (auto &disk_policy: disk_policies)
+        for (auto &allocator: allocators){
+            configs_.push_back(SweepConfig{mem_size, num_disks, num_cores, policy, disk_policy, allocator});
+        }
+    }
+
+    // Gets the number of configurations in the grid.
+    size_t size(){
+        return configs_.size();
+    }
+
+    // Replays a trace against every configuration of the grid.
+    // param trace: The trace every run replays; it is only read.
+    // param threads: The number of runs at a time.
+    void run(const Trace &trace, const unsigned int &threads){
+        results_.assign(configs_.size(), SweepResult());
+        atomic<size_t> next{0};
+        auto worker = [&](){
+            for (size_t index = next++; index < configs_.size(); index = next++){
+                results_[index] = runOne(configs_[index], trace);
+            }
+        };
+        vector<thread> pool;
+        for (unsigned int i = 1; i < min<size_t>(threads, configs_.size()); i++){
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto &thread: pool){
+            thread.join();
+        }
+    }
+
+    // Gets the results of every configuration as a table, one row each, in grid order.
+    // return: A string of the table.
+    string printResults(){
+        stringstream ss;
+        ss << left << setw(12) << "Memory" << setw(7) << "Disks" << setw(7) << "Cores" << setw(10) << "Policy"
+           << setw(8) << "Disk" << setw(7) << "Alloc" << right << setw(10) << "Completed" << setw(10) << "Rejected"
+           << setw(10) << "Quanta" << setw(10) << "Wait" << setw(12) << "Throughput" << setw(8) << "CPU%"
+           << setw(10) << "Turn p50" << setw(10) << "Turn p99" << setw(8) << "Frag%" << setw(12) << "Seek"
+           << setw(11) << "Migrations" << '\n';
+        for (size_t index = 0; index < configs_.size(); index++){
+            SweepConfig &config = configs_[index];
+            SweepResult &result = results_[index];
+            ss << left << setw(12) << config.mem_size_ << setw(7) << config.num_disks_ << setw(7) << config.cores_
+               << setw(10) << config.policy_ << setw(8) << diskPolicyName(config.disk_policy_)
+               << setw(7) << config.allocator_ << right << setw(10) << result.completed_
+               << setw(10) << result.rejected_ << setw(10) << result.ticks_ << fixed << setprecision(2)
+               << setw(10) << result.mean_wait_ << setprecision(4)
+               << setw(12) << (result.ticks_ > 0 ? (double)result.completed_ / result.ticks_ : 0)
+               << setprecision(1) << setw(8) << result.utilization_ << setw(10) << result.turnaround_p50_
+               << setw(10) << result.turnaround_p99_ << setw(8) << result.fragmentation_ / 10.0
+               << setw(12) << result.seek_ << setw(11) << result.migrations_ << '\n';
+            ss.unsetf(ios::fixed);
+        }
+        return ss.str();
+    }
+
+private:
+    vector<SweepConfig> configs_;
+    vector<SweepResult> results_;
+    int num_priorities_ = 5;
+    unsigned int page_size_ = 4096;
+    unsigned int cylinders_ = 200;
+
+    // Builds a silent System for a configuration and replays the trace against it.
+    SweepResult runOne(const SweepConfig &config, const Trace &trace){
+        unique_ptr<System> system(new System());
+        system->setOutput(nullptr);
+        system->setPriorityLevels(num_priorities_);
+        system->setPageSize(page_size_);
+        system->setPolicy(config.policy_);
+        system->setAllocator(config.allocator_);
+        system->setCores(config.cores_);
+        system->setDiskScheduling(config.disk_policy_, cylinders_);
+        system->setupMemory(config.mem_size_);
+        system->setDisk(config.num_disks_);
+
+        int pid_tracker = 1;
+        for (auto &command: trace.commands()){
+            if (command.op_ == 'q'){
+                break;
+            }
+            system->execute(command, pid_tracker);
+        }
+
+        SweepResult result;
+        Metrics &metrics = system->getMetrics();
+        result.completed_ = system->getCompleted();
+        result.rejected_ = metrics.getRejected();
+        result.ticks_ = system->getTicks();
+        result.mean_wait_ = system->getMeanWait();
+        result.utilization_ = metrics.getUtilization();
+        result.turnaround_p50_ = metrics.getTurnaround().percentile(0.5);
+        result.turnaround_p99_ = metrics.getTurnaround().percentile(0.99);
+        result.fragmentation_ = metrics.fragmentation();
+        for (int disk = 0; disk < config.num_disks_; disk++){
+            result.seek_ += system->getDiskTotalSeek(disk);
+        }
+        result.migrations_ = metrics.getMigrations();
+        return result;
+    }
+};
+
+#endif
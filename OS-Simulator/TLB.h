@@ -0,0 +1,337 @@
+/*
+  Title          : TLB.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "TLB" class
+  Purpose        : Class project
+*/
+#ifndef __TLB_H__
+#define __TLB_H__
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "Checkpoint.h"
+
+using namespace std;
+
+/*
+Translation look-aside buffer (TLB)::
+
+The TLB is associative, high-speed memory. Each entry in the TLB consists
+of two parts: a key (or tag) and a value. When the associative memory is
+presented with an item, the item is compared with all keys simultaneously.
+If the item is found, the corresponding value field is returned.
+
+If the page number is not in the TLB (known as a TLB miss), a memory
+reference to the page table must be made. Some TLBs store address-space
+identifiers (ASIDs) in each TLB entry. An ASID uniquely identifies each
+process and is used to provide address-space protection, so the TLB can
+contain entries for several different processes simultaneously and does
+not have to be flushed on a context switch.
+
+Here the ASID is the PID. The TLB is split into sets of `ways` entries; a
+page can only live in set (page % sets). One set holding every entry makes
+it fully associative.
+*/
+
+// How the victim entry of a full set is chosen.
+enum TLBPolicy { TLB_LRU, TLB_FIFO, TLB_RANDOM };
+
+// Translation counters of one process, or of the whole system.
+struct TLBStats{
+    unsigned long long hits_ = 0;
+    unsigned long long misses_ = 0;
+    // Memory references made walking the page table.
+    unsigned long long walks_ = 0;
+    unsigned long long faults_ = 0;
+};
+
+class TLB{
+public:
+    // Default constructor/destructor.
+    TLB(){ setupTLB(64, 0, TLB_LRU); }
+    ~TLB() = default;
+
+    // Sets up an empty TLB.
+    // param entries: The number of entries.
+    // param ways: The entries per set; 0 makes the TLB fully associative.
+    // param policy: The replacement policy of a full set.
+    // return: False if the entries cannot be split into sets of `ways`. Otherwise true.
+    bool setupTLB(const unsigned int &entries, const unsigned int &ways, const TLBPolicy &policy){
+        unsigned int set_size = (ways == 0 ? entries : ways);
+        if (entries == 0 || set_size == 0 || entries % set_size != 0){
+            return false;
+        }
+        ways_ = set_size;
+        sets_ = entries / set_size;
+        policy_ = policy;
+        entries_.assign(entries, Entry());
+        index_.clear();
+        return true;
+    }
+
+    // Sets the costs the effective access time is computed from.
+    // param tlb_ns: Time of a TLB lookup.
+    // param memory_ns: Time of a memory reference.
+    // param levels: Memory references needed to walk the page table.
+    void setTimings(const double &tlb_ns, const double &memory_ns, const unsigned int &levels){
+        tlb_ns_ = tlb_ns;
+        memory_ns_ = memory_ns;
+        walk_levels_ = levels;
+    }
+
+    // Looks up the translation of a page.
+    // param asid: The PID of the process.
+    // param page: The page number.
+    // param frame: Set to the frame number on a hit.
+    // return: True on a TLB hit. Otherwise false.
+    bool lookup(const int &asid, const unsigned int &page, unsigned int &frame){
+        TLBStats &process = stats_[asid];
+        auto found = index_.find(key(asid, page));
+        if (found == index_.end()){
+            process.misses_++;
+            total_.misses_++;
+            return false;
+        }
+        Entry &entry = entries_[found->second];
+        entry.used_ = ++clock_;
+        frame = entry.frame_;
+        process.hits_++;
+        total_.hits_++;
+        return true;
+    }
+
+    // Records the page table walk that followed a miss.
+    // param asid: The PID of the process.
+    // param fault: True if the walk found the page missing from memory.
+    void recordWalk(const int &asid, const bool &fault){
+        TLBStats &process = stats_[asid];
+        process.walks_ += walk_levels_;
+        total_.walks_ += walk_levels_;
+        if (fault){
+            process.faults_++;
+            total_.faults_++;
+        }
+    }
+
+    // Caches the translation found by a page table walk.
+    // param asid: The PID of the process.
+    // param page: The page number.
+    // param frame: The frame number.
+    void insert(const int &asid, const unsigned int &page, const unsigned int &frame){
+        unsigned int first = (page % sets_) * ways_;
+        unsigned int slot = first;
+        for (unsigned int way = first; way < first + ways_; way++){
+            if (!entries_[way].valid_){
+                slot = way;
+                break;
+            }
+            if (policy_ == TLB_LRU && entries_[way].used_ < entries_[slot].used_){
+                slot = way;
+            } else if (policy_ == TLB_FIFO && entries_[way].loaded_ < entries_[slot].loaded_){
+                slot = way;
+            }
+        }
+        if (entries_[slot].valid_ && policy_ == TLB_RANDOM){
+            random_ ^= random_ << 13;
+            random_ ^= random_ >> 7;
+            random_ ^= random_ << 17;
+            slot = first + random_ % ways_;
+        }
+        Entry &entry = entries_[slot];
+        if (entry.valid_){
+            index_.erase(key(entry.asid_, entry.page_));
+        }
+        entry.valid_ = true;
+        entry.asid_ = asid;
+        entry.page_ = page;
+        entry.frame_ = frame;
+        entry.used_ = entry.loaded_ = ++clock_;
+        index_[key(asid, page)] = slot;
+    }
+
+    // Drops the translation of a page that left memory.
+    // param asid: The PID of the process.
+    // param page: The page number.
+    void invalidate(const int &asid, const unsigned int &page){
+        auto found = index_.find(key(asid, page));
+        if (found != index_.end()){
+            entries_[found->second].valid_ = false;
+            index_.erase(found);
+        }
+    }
+
+    // Drops every translation and the counters of a terminated process.
+    // param asid: The PID of the process.
+    void flush(const int &asid){
+        for (unsigned int slot = 0; slot < entries_.size(); slot++){
+            if (entries_[slot].valid_ && entries_[slot].asid_ == asid){
+                entries_[slot].valid_ = false;
+                index_.erase(key(asid, entries_[slot].page_));
+            }
+        }
+        stats_.erase(asid);
+    }
+
+    // Drops every translation and counter, keeping the geometry and timings.
+    void clear(){
+        entries_.assign(entries_.size(), Entry());
+        index_.clear();
+        clock_ = 0;
+        stats_.clear();
+        total_ = TLBStats();
+    }
+
+    // Gets the system wide counters.
+    const TLBStats& getTotal(){
+        return total_;
+    }
+
+    // Describes the geometry and replacement policy, which a checkpoint
+    // can only be restored into.
+    string geometry(){
+        stringstream ss;
+        ss << entries_.size() << " TLB entries (" << sets_ << " sets x " << ways_ << " ways, " << policyName() << ")";
+        return ss.str();
+    }
+
+    // Writes the entries and counters to a checkpoint. The geometry and
+    // timings are part of the setup, not of the state.
+    void save(CheckpointWriter &out){
+        out.put<unsigned long long>(entries_.size());
+        for (auto &entry: entries_){
+            out.put(entry.valid_);
+            out.put(entry.asid_);
+            out.put(entry.page_);
+            out.put(entry.frame_);
+            out.put(entry.used_);
+            out.put(entry.loaded_);
+        }
+        out.put(clock_);
+        out.put(random_);
+        out.put<unsigned long long>(stats_.size());
+        for (auto &process: stats_){
+            out.put(process.first);
+            out.put(process.second);
+        }
+        out.put(total_);
+    }
+
+    // Replaces the entries and counters with the ones save wrote, into a TLB
+    // of the same geometry.
+    void load(CheckpointReader &in){
+        if (in.get<unsigned long long>() != entries_.size()){
+            in.fail();
+            return;
+        }
+        for (auto &entry: entries_){
+            entry.valid_ = in.get<bool>();
+            entry.asid_ = in.get<int>();
+            entry.page_ = in.get<unsigned int>();
+            entry.frame_ = in.get<unsigned int>();
+            entry.used_ = in.get<unsigned long long>();
+            entry.loaded_ = in.get<unsigned long long>();
+        }
+        clock_ = in.get<unsigned long long>();
+        random_ = in.get<unsigned long long>();
+        stats_.clear();
+        unsigned long long count = in.get<unsigned long long>();
+        for (unsigned long long i = 0; i < count && in.ok(); i++){
+            int asid = in.get<int>();
+            stats_[asid] = in.get<TLBStats>();
+        }
+        total_ = in.get<TLBStats>();
+        index_.clear();
+        for (unsigned int slot = 0; slot < entries_.size(); slot++){
+            if (entries_[slot].valid_){
+                index_[key(entries_[slot].asid_, entries_[slot].page_)] = slot;
+            }
+        }
+    }
+
+    // Computes the average time of a memory reference.
+    // param stats: The counters to average over.
+    // return: The effective access time in ns.
+    double accessTime(const TLBStats &stats){
+        unsigned long long references = stats.hits_ + stats.misses_;
+        if (references == 0){
+            return 0;
+        }
+        return tlb_ns_ + memory_ns_ + memory_ns_ * stats.walks_ / references;
+    }
+
+    // Gets the translation statistics of the system and every live process.
+    // return: A string of the TLB snapshot.
+    string printTLB(){
+        stringstream ss;
+        ss << " ===================================\n";
+        ss << "|              T L B                |\n";
+        ss << " ===================================\n\n";
+        ss << "\tEntries >> " << entries_.size() << " (" << sets_ << " sets x " << ways_ << " ways, "
+           << policyName() << ")\n"
+           << "\tTimings >> TLB " << tlb_ns_ << " ns, memory " << memory_ns_ << " ns, "
+           << walk_levels_ << " level page walk\n\n";
+        ss << "\tSystem:\n" << printStats(total_) << endl;
+        for (auto &process: stats_){
+            ss << "\tPID " << process.first << ":\n" << printStats(process.second) << endl;
+        }
+        return ss.str();
+    }
+
+private:
+    struct Entry{
+        bool valid_ = false;
+        int asid_ = 0;
+        unsigned int page_ = 0;
+        unsigned int frame_ = 0;
+        // Clock values of the last hit and of the insertion.
+        unsigned long long used_ = 0;
+        unsigned long long loaded_ = 0;
+    };
+
+    unsigned int sets_ = 1;
+    unsigned int ways_ = 1;
+    TLBPolicy policy_ = TLB_LRU;
+    // Every entry, set after set.
+    vector<Entry> entries_;
+    // Slot of every valid entry, keyed by (asid, page).
+    unordered_map<unsigned long long, unsigned int> index_;
+    // Advances on every hit and insertion; orders entries for LRU and FIFO.
+    unsigned long long clock_ = 0;
+    // State of the xorshift generator used by the random policy.
+    unsigned long long random_ = 88172645463325252ULL;
+
+    double tlb_ns_ = 1;
+    double memory_ns_ = 100;
+    unsigned int walk_levels_ = 1;
+
+    // Counters of every live process, by PID, and of the whole system.
+    map<int, TLBStats> stats_;
+    TLBStats total_;
+
+    const char* policyName(){
+        return policy_ == TLB_LRU ? "LRU" : policy_ == TLB_FIFO ? "FIFO" : "random";
+    }
+
+    static unsigned long long key(const int &asid, const unsigned int &page){
+        return ((unsigned long long)(unsigned int)asid << 32) | page;
+    }
+
+    string printStats(const TLBStats &stats){
+        stringstream ss;
+        unsigned long long references = stats.hits_ + stats.misses_;
+        ss << "\t\tReferences >> " << references << endl
+           << "\t\tHit rate >> " << (references == 0 ? 0 : 100.0 * stats.hits_ / references) << "%\n"
+           << "\t\tPage walk references >> " << stats.walks_ << endl
+           << "\t\tPage faults >> " << stats.faults_ << endl
+           << "\t\tEffective access time >> " << accessTime(stats) << " ns\n";
+        return ss.str();
+    }
+};
+
+#endif
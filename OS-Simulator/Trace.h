@@ -0,0 +1,227 @@
+/*
+  Title          : Trace.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "TraceReader", "TraceFile" and "Trace" classes
+  Purpose        : Class project
+*/
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Command.h"
+
+using namespace std;
+
+// Reads a trace one line at a time through a large buffer.
+// A replay does one fread per megabyte instead of one getline per command.
+class TraceReader{
+public:
+    explicit TraceReader(FILE *in) : in_{in}, buffer_(1 << 20), pos_{0}, end_{0}{}
+
+    // Gets the next line of the trace, without the line terminator.
+    // param line: Filled with the next line.
+    // return: False once the trace is exhausted. Otherwise true.
+    bool next(string &line){
+        line.clear();
+        while(true){
+            if(pos_ == end_){
+                end_ = fread(buffer_.data(), 1, buffer_.size(), in_);
+                pos_ = 0;
+                if(end_ == 0){
+                    return !line.empty();
+                }
+            }
+            const char *start = buffer_.data() + pos_;
+            const char *newline = static_cast<const char*>(memchr(start, '\n', end_ - pos_));
+            if(newline == nullptr){
+                line.append(start, end_ - pos_);
+                pos_ = end_;
+                continue;
+            }
+            line.append(start, newline - start);
+            pos_ += (newline - start) + 1;
+            if(!line.empty() && line.back() == '\r'){
+                line.pop_back();
+            }
+            return true;
+        }
+    }
+
+private:
+    FILE *in_;
+    vector<char> buffer_;
+    size_t pos_;
+    size_t end_;
+};
+
+// The lines of a trace: a file mapped in memory, read in place, or stdin,
+// read through a TraceReader.
+class TraceFile{
+public:
+    TraceFile() = default;
+    TraceFile(const TraceFile &rhs) = delete;
+    TraceFile& operator=(const TraceFile &rhs) = delete;
+
+    ~TraceFile(){
+        if(map_ != nullptr){
+            munmap(map_, length_);
+        }
+        if(in_ != nullptr && in_ != stdin){
+            fclose(in_);
+        }
+    }
+
+    // Opens a trace. A file is mapped, unless it cannot be (a pipe), then it is read.
+    // param path: The trace file, or "-" for stdin.
+    // param error: Set to why the trace cannot be opened.
+    // return: False if the trace cannot be opened. Otherwise true.
+    bool open(const string &path, string &error){
+        if(path == "-"){
+            in_ = stdin;
+            reader_.reset(new TraceReader(in_));
+            return true;
+        }
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0){
+            error = "Cannot open trace file " + path;
+            return false;
+        }
+        struct stat info;
+        if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode)){
+            length_ = info.st_size;
+            void* map = length_ == 0 ? MAP_FAILED : mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(map != MAP_FAILED){
+                ::close(fd);
+                map_ = map;
+                madvise(map_, length_, MADV_SEQUENTIAL);
+                pos_ = static_cast<const char*>(map_);
+                end_ = pos_ + length_;
+                return true;
+            }
+        }
+        in_ = fdopen(fd, "r");
+        if(in_ == nullptr){
+            ::close(fd);
+            error = "Cannot read trace file " + path;
+            return false;
+        }
+        reader_.reset(new TraceReader(in_));
+        return true;
+    }
+
+    // Tells whether the lines stay where they are until the trace is closed,
+    // rather than until the next line is read.
+    bool mapped() const{
+        return map_ != nullptr;
+    }
+
+    // Gets the next line, without its terminator.
+    // param begin: Set to the first character of the line.
+    // param end: Set past the last character of the line.
+    // return: False once the trace is exhausted. Otherwise true.
+    bool next(const char* &begin, const char* &end){
+        if(reader_ != nullptr){
+            if(!reader_->next(line_)){
+                return false;
+            }
+            begin = line_.data();
+            end = begin + line_.size();
+        } else {
+            if(pos_ == end_){
+                return false;
+            }
+            const char *newline = static_cast<const char*>(memchr(pos_, '\n', end_ - pos_));
+            begin = pos_;
+            end = newline == nullptr ? end_ : newline;
+            pos_ = newline == nullptr ? end_ : newline + 1;
+        }
+        number_++;
+        return true;
+    }
+
+    // Gets the number of the last line read, from 1.
+    unsigned long long line() const{
+        return number_;
+    }
+
+private:
+    void* map_ = nullptr;
+    size_t length_ = 0;
+    const char* pos_ = nullptr;
+    const char* end_ = nullptr;
+    FILE* in_ = nullptr;
+    unique_ptr<TraceReader> reader_;
+    string line_;
+    unsigned long long number_ = 0;
+};
+
+// A whole trace of commands in memory, parsed, without the empty lines and
+// the comments. It is read once and never changes, so any number of threads
+// can replay it at the same time.
+class Trace{
+public:
+    // Reads and parses a trace.
+    // param path: The trace file, or "-" for stdin.
+    // param error: Set to why the trace cannot be read, with the line at fault.
+    // return: False if the trace cannot be opened, or a line is not a valid command. Otherwise true.
+    bool load(const string &path, string &error){
+        if(!file_.open(path, error)){
+            return false;
+        }
+        const char *begin, *end;
+        Command command;
+        while(file_.next(begin, end)){
+            if(!file_.mapped()){
+                //the parsed fields point into the line, which must outlive them
+                lines_.push_back(string(begin, end));
+                begin = lines_.back().data();
+                end = begin + lines_.back().size();
+            }
+            if(!CommandParser(begin, end).parse(command, error)){
+                error = "Line " + to_string(file_.line()) + ": " + error;
+                return false;
+            }
+            if(command.op_ != Command::NONE){
+                commands_.push_back(command);
+                numbers_.push_back(file_.line());
+            }
+        }
+        return true;
+    }
+
+    const vector<Command>& commands() const{
+        return commands_;
+    }
+
+    size_t size() const{
+        return commands_.size();
+    }
+
+    // Gets the line of the trace a command was read from, from 1.
+    // param index: The index of the command in commands().
+    unsigned long long line(const size_t &index) const{
+        return numbers_[index];
+    }
+
+private:
+    TraceFile file_;
+    // The lines of a trace that is not mapped.
+    deque<string> lines_;
+    vector<Command> commands_;
+    // The line of every command.
+    vector<unsigned long long> numbers_;
+};
+
+#endif
@@ -0,0 +1,252 @@
+/*
+  Title          : Workload.h
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : interface for the "Workload" class
+  Purpose        : Class project
+*/
+#ifndef __WORKLOAD_H__
+#define __WORKLOAD_H__
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+Synthetic workload::
+
+A trace has to be written before it is replayed, and every line of it is
+parsed again. The workload generator draws the processes and their requests
+from distributions instead, and hands them to the System as they are needed,
+so a run of any length costs no memory and no parsing.
+
+Arrivals are a Poisson process when the time between two of them is
+exponential. Real arrivals are burstier: a job fans out into many processes
+at once. With batches, each Poisson arrival brings a batch of processes, one
+more after another with probability 1 - 1/n, so a batch has n processes on
+average, and the processes of a batch arrive a short time apart.
+
+Process sizes are lognormal in most measured systems: many small processes
+and a long tail of large ones. The lognormal with median m and shape s is
+e^X, where X is normal with mean ln m and standard deviation s.
+
+The priority mix and the disk mix are weights: a process has priority k, or
+a request goes to disk k, with probability weight k / the sum of the weights.
+
+Every draw comes from one generator seeded once, so the same seed gives the
+same workload.
+*/
+
+// A distribution of times (or sizes) the simulation draws from.
+class Distribution{
+public:
+    enum Kind : unsigned char { CONSTANT, UNIFORM, EXPONENTIAL, LOGNORMAL };
+
+    Distribution() = default;
+    Distribution(const Kind &kind, const double &low, const double &high) : kind_{kind}, low_{low}, high_{high}{}
+
+    // Parses "<value>", "const:<value>", "uniform:<low>:<high>", "exp:<mean>"
+    // or "lognormal:<median>:<shape>".
+    // param text: The description of the distribution.
+    // param distribution: Set to the distribution described.
+    // return: False if the text is not a valid distribution. Otherwise true.
+    static bool parse(const string &text, Distribution &distribution){
+        string kind = text;
+        double low = 0, high = 0;
+        size_t colon = text.find(':');
+        if (colon != string::npos){
+            kind = text.substr(0, colon);
+        }
+        string values = colon == string::npos ? text : text.substr(colon + 1);
+        for (auto &c: values){
+            if (c == ':'){
+                c = ' ';
+            }
+        }
+        stringstream ss(values);
+        if (!(ss >> low) || low < 0 || ((kind == "exp" || kind == "lognormal") && low == 0)){
+            return false;
+        }
+        if (colon == string::npos || kind == "const"){
+            distribution = Distribution(CONSTANT, low, low);
+        } else if (kind == "exp"){
+            distribution = Distribution(EXPONENTIAL, low, low);
+        } else if (kind == "uniform" && ss >> high && high >= low){
+            distribution = Distribution(UNIFORM, low, high);
+        } else if (kind == "lognormal" && ss >> high && high >= 0){
+            distribution = Distribution(LOGNORMAL, low, high);
+        } else {
+            return false;
+        }
+        string rest;
+        return !(ss >> rest);
+    }
+
+    // Draws a value, at least 1.
+    unsigned long long sample(mt19937_64 &random){
+        double value = low_;
+        if (kind_ == UNIFORM){
+            value = uniform_real_distribution<double>(low_, high_)(random);
+        } else if (kind_ == EXPONENTIAL){
+            value = exponential_distribution<double>(1.0 / low_)(random);
+        } else if (kind_ == LOGNORMAL){
+            value = lognormal_distribution<double>(log(low_), high_)(random);
+        }
+        if (value >= 1e18){
+            return 1000000000000000000ULL;
+        }
+        return value < 1 ? 1 : (unsigned long long)value;
+    }
+
+private:
+    Kind kind_ = CONSTANT;
+    double low_ = 1;
+    double high_ = 1;
+};
+
+// What the simulated workload looks like. Times are in microseconds.
+struct SimulationConfig{
+    // How long the simulation runs.
+    unsigned long long duration_ = 3600000000ULL;
+    // Time between two arrivals, or between two batches of arrivals.
+    Distribution arrival_{Distribution::EXPONENTIAL, 100000, 100000};
+    // Mean number of processes arriving in a batch; 1 for no batches.
+    unsigned long long batch_size_ = 1;
+    // Time between two arrivals of the same batch.
+    Distribution batch_gap_{Distribution::EXPONENTIAL, 1000, 1000};
+    // Total CPU time a process needs before it terminates.
+    Distribution burst_{Distribution::EXPONENTIAL, 50000, 50000};
+    // CPU time a process runs between two disk requests.
+    Distribution io_interval_{Distribution::EXPONENTIAL, 20000, 20000};
+    // Time a disk takes to serve a request.
+    Distribution disk_service_{Distribution::EXPONENTIAL, 10000, 10000};
+    // The time quantum; a process keeps the CPU for one or more quanta.
+    Distribution quantum_{Distribution::CONSTANT, 10000, 10000};
+    // Time the disk head takes to move one cylinder, added to the service time.
+    unsigned long long seek_us_ = 0;
+    // Memory a process needs, in bytes.
+    Distribution memory_{Distribution::UNIFORM, 1000, 100000};
+    // Weight of each priority level, from 0; empty for every level alike.
+    vector<double> priority_mix_;
+    // Weight of each disk, from 0; empty for every disk alike.
+    vector<double> disk_mix_;
+    // Seeds every random draw, so a run can be repeated.
+    unsigned long long seed_ = 1;
+};
+
+class Workload{
+public:
+    // The largest process the System can hold.
+    static const unsigned long long MAX_MEMORY = 4000000000ULL;
+
+    // param config: The workload; its mixes must fit the system.
+    // param num_priorities: The number of priority levels of the system.
+    // param num_disks: The number of disks in the system.
+    // param cylinders: The cylinders of every disk.
+    Workload(const SimulationConfig &config, const int &num_priorities, const int &num_disks,
+             const unsigned int &cylinders)
+        : config_(config), random_(config.seed_), num_priorities_{num_priorities}, num_disks_{num_disks},
+          cylinders_{cylinders}, priority_mix_(config.priority_mix_.begin(), config.priority_mix_.end()),
+          disk_mix_(config.disk_mix_.begin(), config.disk_mix_.end()){}
+
+    // Parses a mix: comma separated weights, not negative, at least one positive.
+    // param text: The weights of 0, 1, ...
+    // param mix: Set to the weights.
+    // param most: The most weights there can be.
+    // return: False if the text is not a valid mix. Otherwise true.
+    static bool parseMix(const string &text, vector<double> &mix, const size_t &most){
+        mix.clear();
+        stringstream list(text);
+        string weight;
+        double total = 0;
+        while (getline(list, weight, ',')){
+            stringstream ss(weight);
+            double value;
+            string rest;
+            if (!(ss >> value) || value < 0 || ss >> rest){
+                return false;
+            }
+            mix.push_back(value);
+            total += value;
+        }
+        return total > 0 && mix.size() <= most;
+    }
+
+    // Draws the time until the next process arrives.
+    unsigned long long nextArrival(){
+        if (batch_left_ > 0){
+            batch_left_--;
+            return config_.batch_gap_.sample(random_);
+        }
+        if (config_.batch_size_ > 1){
+            //the processes that follow the first one of the batch
+            batch_left_ = geometric_distribution<unsigned long long>(1.0 / config_.batch_size_)(random_);
+        }
+        return config_.arrival_.sample(random_);
+    }
+
+    // Draws the priority of a new process.
+    int priority(){
+        if (config_.priority_mix_.empty()){
+            return uniform_int_distribution<int>(0, num_priorities_ - 1)(random_);
+        }
+        return priority_mix_(random_);
+    }
+
+    // Draws the memory of a new process in bytes, at most MAX_MEMORY.
+    unsigned int memory(){
+        unsigned long long bytes = config_.memory_.sample(random_);
+        return bytes > MAX_MEMORY ? MAX_MEMORY : bytes;
+    }
+
+    // Draws the total CPU time of a new process.
+    unsigned long long burst(){
+        return config_.burst_.sample(random_);
+    }
+
+    // Draws the CPU time until the next disk request.
+    unsigned long long ioInterval(){
+        return config_.io_interval_.sample(random_);
+    }
+
+    // Draws the disk a request goes to.
+    int disk(){
+        if (config_.disk_mix_.empty()){
+            return uniform_int_distribution<int>(0, num_disks_ - 1)(random_);
+        }
+        return disk_mix_(random_);
+    }
+
+    // Draws the cylinder of a disk request.
+    unsigned int cylinder(){
+        return uniform_int_distribution<unsigned int>(0, cylinders_ - 1)(random_);
+    }
+
+    // Draws the time a disk takes to serve a request, not counting the seek.
+    unsigned long long diskService(){
+        return config_.disk_service_.sample(random_);
+    }
+
+    // Draws a time quantum.
+    unsigned long long quantum(){
+        return config_.quantum_.sample(random_);
+    }
+
+private:
+    SimulationConfig config_;
+    mt19937_64 random_;
+    int num_priorities_;
+    int num_disks_;
+    unsigned int cylinders_;
+    discrete_distribution<int> priority_mix_;
+    discrete_distribution<int> disk_mix_;
+    // The processes of the current batch that did not arrive yet.
+    unsigned long long batch_left_ = 0;
+};
+
+#endif
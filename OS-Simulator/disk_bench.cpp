@@ -0,0 +1,65 @@
+/*
+  Title          : disk_bench.cpp
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : throughput of the threaded disks from 1 to 10 disks
+  Purpose        : Class project
+*/
+
+#include <iostream>
+#include <chrono>
+#include <string>
+
+#include "Memory.h"
+using namespace std;
+
+// Keeps every disk busy: whenever a process holds the CPU it asks for the
+// next disk in turn, and the scheduler handles disk interrupts in between.
+// param num_disks: The number of disks, each served by its own thread.
+// param service_us: How long a disk takes per request.
+// param requests: How many requests to finish.
+// return: Requests finished per second.
+double run(const int &num_disks, const unsigned int &service_us, const int &requests){
+    System system;
+    //the System reports every event; keep it out of the timings
+    system.setOutput(nullptr);
+    system.setupMemory(1000000000u);
+    system.setDiskWorkers(service_us);
+    system.setDisk(num_disks);
+
+    int pid_tracker = 1;
+    for(int i = 0; i < 32 * num_disks; i++){
+        system.newProcess(1, 1000, pid_tracker);
+    }
+
+    int finished = 0;
+    int next_disk = 0;
+    auto begin = chrono::steady_clock::now();
+    while(finished < requests){
+        if(system.getCPUprocess() != nullptr){
+            system.requestIO(next_disk, "file");
+            next_disk = (next_disk + 1) % num_disks;
+        }
+        finished += system.pollDisks();
+    }
+    auto elapsed = chrono::steady_clock::now() - begin;
+    system.drainDisks();
+    return requests / chrono::duration<double>(elapsed).count();
+}
+
+int main(int argc, const char * argv[]){
+    unsigned int service_us = argc > 1 ? stoul(argv[1]) : 100;
+    const int requests = 20000;
+
+    double throughput[11];
+    for(int disks = 1; disks <= 10; disks++){
+        throughput[disks] = run(disks, service_us, requests);
+    }
+
+    cout << "disks,service_us,requests,requests_per_sec,speedup\n";
+    for(int disks = 1; disks <= 10; disks++){
+        cout << disks << "," << service_us << "," << requests << "," << throughput[disks] << ","
+             << throughput[disks] / throughput[1] << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+  Title          : frame_bench.cpp
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : benchmark of the "FrameBitmap" against a vector<bool> scan
+  Purpose        : Class project
+*/
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "FrameBitmap.h"
+using namespace std;
+
+// The naive free frame map: a vector<bool>, scanned from frame 0 one frame
+// at a time.
+class VectorBoolFrames{
+public:
+    void grow(const unsigned int &size){
+        free_.resize(size, false);
+    }
+
+    void release(const unsigned int &frame){
+        free_[frame] = true;
+    }
+
+    void take(const unsigned int &frame){
+        free_[frame] = false;
+    }
+
+    bool isFree(const unsigned int &frame){
+        return free_[frame];
+    }
+
+    unsigned int findFree(){
+        for (unsigned int frame = 0; frame < free_.size(); frame++){
+            if (free_[frame]){
+                return frame;
+            }
+        }
+        return FrameBitmap::NONE;
+    }
+
+    unsigned int findRun(const unsigned int &count){
+        unsigned int length = 0;
+        for (unsigned int frame = 0; frame < free_.size(); frame++){
+            length = free_[frame] ? length + 1 : 0;
+            if (length == count){
+                return frame + 1 - count;
+            }
+        }
+        return FrameBitmap::NONE;
+    }
+
+private:
+    vector<bool> free_;
+};
+
+FrameBitmap bitmap(const FrameBitmap::Scan &scan){
+    FrameBitmap frames;
+    frames.setScan(scan);
+    return frames;
+}
+
+// Fills every frame, then frees `free_frames` of them at random, then times
+// `ops` page faults: take the lowest free frame, and free a random used one.
+// return: Nanoseconds per fault, and the sum of the frames taken in checksum.
+template <class Frames>
+double runFree(Frames frames, const unsigned int &num_frames, const unsigned int &free_frames,
+               const unsigned int &ops, unsigned long long &checksum){
+    mt19937 rng(42);
+    uniform_int_distribution<unsigned int> any(0, num_frames - 1);
+    frames.grow(num_frames);
+    for (unsigned int i = 0; i < free_frames; i++){
+        frames.release(any(rng));
+    }
+    checksum = 0;
+    auto begin = chrono::steady_clock::now();
+    for (unsigned int i = 0; i < ops; i++){
+        unsigned int frame = frames.findFree();
+        frames.take(frame);
+        checksum += frame;
+        unsigned int victim = any(rng);
+        while (frames.isFree(victim) || victim == frame){
+            victim = any(rng);
+        }
+        frames.release(victim);
+    }
+    auto elapsed = chrono::steady_clock::now() - begin;
+    return chrono::duration<double, nano>(elapsed).count() / ops;
+}
+
+// Frees one frame in 8 at random, so runs are short, plus one run of `count`
+// frames at a random place in the top half, then times `ops` searches for a
+// run of `count` frames.
+// return: Nanoseconds per search, and the run found in found.
+template <class Frames>
+double runRun(Frames frames, const unsigned int &num_frames, const unsigned int &count,
+              const unsigned int &ops, unsigned int &found){
+    mt19937 rng(7);
+    uniform_int_distribution<unsigned int> any(0, num_frames - 1);
+    frames.grow(num_frames);
+    for (unsigned int i = 0; i < num_frames / 8; i++){
+        frames.release(any(rng));
+    }
+    unsigned int run = num_frames / 2 + any(rng) % (num_frames / 2 - count);
+    for (unsigned int frame = run; frame < run + count; frame++){
+        frames.release(frame);
+    }
+    found = 0;
+    auto begin = chrono::steady_clock::now();
+    for (unsigned int i = 0; i < ops; i++){
+        found = frames.findRun(count);
+    }
+    auto elapsed = chrono::steady_clock::now() - begin;
+    return chrono::duration<double, nano>(elapsed).count() / ops;
+}
+
+int main(){
+    // 4,000,000,000 bytes of RAM in frames of 4096 and of 256 bytes.
+    vector<unsigned int> sizes = {976562, 15625000};
+    FrameBitmap::Scan best = FrameBitmap::bestScan();
+    const char* names[] = {"scalar", "sse2", "avx2"};
+    cout << "scan: " << names[best] << "\n";
+
+    cout << "test,frames,bitmap_ns_per_op,bitmap_scalar_ns_per_op,vector_bool_ns_per_op,speedup\n";
+    for (auto &frames: sizes){
+        unsigned long long simd_sum, scalar_sum, naive_sum;
+        double simd = runFree(bitmap(best), frames, 64, 200000, simd_sum);
+        double scalar = runFree(bitmap(FrameBitmap::SCALAR), frames, 64, 200000, scalar_sum);
+        double naive = runFree(VectorBoolFrames(), frames, 64, 2000, naive_sum);
+        unsigned long long check;
+        runFree(bitmap(best), frames, 64, 2000, check);
+        if (simd_sum != scalar_sum || check != naive_sum){
+            cerr << "ERROR: The bitmap and the vector<bool> took different frames.\n";
+            return 1;
+        }
+        cout << "find_free," << frames << "," << simd << "," << scalar << "," << naive << ","
+             << naive / simd << "\n";
+    }
+    for (auto &frames: sizes){
+        unsigned int simd_run, scalar_run, naive_run;
+        double simd = runRun(bitmap(best), frames, 64, 200, simd_run);
+        double scalar = runRun(bitmap(FrameBitmap::SCALAR), frames, 64, 200, scalar_run);
+        double naive = runRun(VectorBoolFrames(), frames, 64, 20, naive_run);
+        if (simd_run != scalar_run || simd_run != naive_run){
+            cerr << "ERROR: The bitmap and the vector<bool> found different runs.\n";
+            return 1;
+        }
+        cout << "find_run_64," << frames << "," << simd << "," << scalar << "," << naive << ","
+             << naive / simd << "\n";
+    }
+    return 0;
+}
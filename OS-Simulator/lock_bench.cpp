@@ -0,0 +1,110 @@
+/*
+  Title          : lock_bench.cpp
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : contention benchmark of the locks in Locks.h
+  Purpose        : Class project
+*/
+
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Locks.h"
+using namespace std;
+
+// The data the critical section works on.
+struct Shared{
+    unsigned long long counter_ = 0;
+    unsigned long long reads_ = 0;
+};
+
+// One critical section per lock type: a write of the shared counter, or for
+// the reader-writer lock, nine reads for every write.
+template <class Lock>
+void critical(Lock &lock, Shared &shared, const unsigned long long &){
+    lock_guard<Lock> guard(lock);
+    shared.counter_++;
+}
+
+void critical(MCSLock &lock, Shared &shared, const unsigned long long &){
+    MCSLock::Guard guard(lock);
+    shared.counter_++;
+}
+
+void critical(RWSpinLock &lock, Shared &shared, const unsigned long long &iteration){
+    if (iteration % 10 == 0){
+        lock.lock();
+        shared.counter_++;
+        lock.unlock();
+    } else {
+        lock.lock_shared();
+        volatile unsigned long long value = shared.counter_;
+        (void)value;
+        lock.unlock_shared();
+    }
+}
+
+// Runs `threads` threads through the critical section for `duration`.
+// Prints one CSV row: acquisitions per second, then two fairness measures
+// over the per-thread acquisition counts: Jain's index ((sum x)^2 / (n sum x^2),
+// 1 when every thread got the same share) and the smallest over the largest.
+template <class Lock>
+void run(const string &name, const int &threads, const chrono::milliseconds &duration){
+    Lock lock;
+    Shared shared;
+    atomic<bool> start{false}, stop{false};
+    vector<unsigned long long> acquired(threads, 0);
+    vector<thread> workers;
+    for (int id = 0; id < threads; id++){
+        workers.push_back(thread([&, id](){
+            while (!start.load(memory_order_acquire)){
+                this_thread::yield();
+            }
+            unsigned long long count = 0;
+            while (!stop.load(memory_order_relaxed)){
+                critical(lock, shared, count);
+                count++;
+            }
+            acquired[id] = count;
+        }));
+    }
+    auto begin = chrono::steady_clock::now();
+    start.store(true, memory_order_release);
+    this_thread::sleep_for(duration);
+    stop.store(true, memory_order_relaxed);
+    for (auto &worker: workers){
+        worker.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    double sum = 0, squares = 0;
+    unsigned long long least = acquired[0], most = acquired[0];
+    for (auto &count: acquired){
+        sum += count;
+        squares += (double)count * count;
+        least = min(least, count);
+        most = max(most, count);
+    }
+    cout << name << "," << threads << "," << sum / seconds << ","
+         << (squares == 0 ? 0 : sum * sum / (threads * squares)) << ","
+         << (most == 0 ? 0 : (double)least / most) << "\n";
+}
+
+int main(int argc, const char * argv[]){
+    chrono::milliseconds duration(argc > 1 ? atoi(argv[1]) : 200);
+    cout << "lock,threads,acquisitions_per_sec,jain_fairness,min_max_ratio\n";
+    for (int threads = 1; threads <= 64; threads *= 2){
+        run<mutex>("std::mutex", threads, duration);
+        run<TTASLock>("ttas", threads, duration);
+        run<TicketLock>("ticket", threads, duration);
+        run<MCSLock>("mcs", threads, duration);
+        run<RWSpinLock>("rwspin_90_read", threads, duration);
+    }
+    return 0;
+}
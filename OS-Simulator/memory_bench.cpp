@@ -0,0 +1,165 @@
+/*
+  Title          : memory_bench.cpp
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : benchmark of the best fit "Memory" against a list scan
+  Purpose        : Class project
+*/
+
+#include <iostream>
+#include <chrono>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "Memory.h"
+using namespace std;
+
+// The original allocator: a first fit scan over the fragment list, and a
+// merge pass over the whole list after every deallocation.
+class ListScanMemory{
+public:
+    ListScanMemory() = default;
+    ~ListScanMemory(){
+        for (auto &node: memory_tracker_){
+            delete node;
+        }
+    }
+
+    void setupMemory(const unsigned int &mem){
+        memory_tracker_.push_back(new MemFrag{0, mem, nullptr, true});
+    }
+
+    bool allocate(PCB* owner){
+        unsigned int byte = owner->getMemorySize();
+        for(auto it = memory_tracker_.begin(); it != memory_tracker_.end(); ++it){
+            if((*it)->hole_ == true && (*it)->byte_ >= byte){
+                memory_tracker_.insert(it, new MemFrag{(*it)->start_, byte, owner, false});
+                (*it)->start_ += byte;
+                (*it)->byte_ -= byte;
+                if((*it)->byte_ == 0){
+                    delete *it;
+                    memory_tracker_.erase(it);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Lays out the fragments directly; building them through allocate()
+    // would cost O(n^2) before the measurement even starts.
+    // param residents: Processes to place back to back, every other one freed.
+    void build(vector<PCB*> &residents){
+        MemFrag* tail = memory_tracker_.back();
+        memory_tracker_.pop_back();
+        for(unsigned int i = 0; i < residents.size(); i++){
+            unsigned int byte = residents[i]->getMemorySize();
+            bool hole = i % 2 == 0;
+            memory_tracker_.push_back(new MemFrag{tail->start_, byte, hole ? nullptr : residents[i], hole});
+            tail->start_ += byte;
+            tail->byte_ -= byte;
+            if(hole){
+                delete residents[i];
+            }
+        }
+        memory_tracker_.push_back(tail);
+    }
+
+    void deallocate(PCB* owner){
+        for(auto &node: memory_tracker_){
+            if(node->owner_ == owner){
+                node->owner_ = nullptr;
+                node->hole_ = true;
+                break;
+            }
+        }
+        merge();
+    }
+
+private:
+    list<MemFrag*> memory_tracker_;
+
+    void merge(){
+        for(auto it = memory_tracker_.begin(); it != memory_tracker_.end(); ){
+            auto next = std::next(it);
+            if(next != memory_tracker_.end() && (*it)->hole_ && (*next)->hole_){
+                (*it)->byte_ += (*next)->byte_;
+                delete *next;
+                memory_tracker_.erase(next);
+            } else {
+                it = next;
+            }
+        }
+    }
+};
+
+// Allocates every process, then frees every other one.
+void build(Memory &ram, vector<PCB*> &residents){
+    for(auto &process: residents){
+        ram.allocate(process);
+    }
+    for(unsigned int i = 0; i < residents.size(); i += 2){
+        ram.deallocate(residents[i]);
+        delete residents[i];
+    }
+}
+
+void build(ListScanMemory &ram, vector<PCB*> &residents){
+    ram.build(residents);
+}
+
+// Fills memory with 2 * fragments processes, frees every other one so the
+// tracker holds about `fragments` holes between `fragments` residents, then
+// times `ops` allocate/deallocate pairs of random sizes.
+// return: Nanoseconds per allocate/deallocate pair.
+template <class Allocator>
+double run(const unsigned int &fragments, const unsigned int &ops){
+    const unsigned int mem_size = 4000000000u;
+    Allocator ram;
+    ram.setupMemory(mem_size);
+    mt19937 rng(42);
+    uniform_int_distribution<unsigned int> size(1, 4096);
+
+    ProcessTable table;
+    int pid = 1;
+    int priority = 0;
+    vector<PCB*> residents;
+    for(unsigned int i = 0; i < 2 * fragments; i++){
+        unsigned int mem = size(rng);
+        residents.push_back(new PCB(table, pid, priority, mem));
+        pid++;
+    }
+    build(ram, residents);
+
+    auto begin = chrono::steady_clock::now();
+    for(unsigned int i = 0; i < ops; i++){
+        unsigned int mem = size(rng);
+        PCB* process = new PCB(table, pid, priority, mem);
+        pid++;
+        ram.allocate(process);
+        ram.deallocate(process);
+        delete process;
+    }
+    auto elapsed = chrono::steady_clock::now() - begin;
+    for(unsigned int i = 1; i < residents.size(); i += 2){
+        delete residents[i];
+    }
+    return chrono::duration<double, nano>(elapsed).count() / ops;
+}
+
+int main(){
+    vector<unsigned int> sizes = {1000, 10000, 100000};
+    vector<double> best_fit, list_scan;
+    for(auto &fragments: sizes){
+        best_fit.push_back(run<Memory>(fragments, 20000));
+        list_scan.push_back(run<ListScanMemory>(fragments, 2000));
+    }
+
+    cout << "fragments,best_fit_ns_per_op,list_scan_ns_per_op,speedup\n";
+    for(unsigned int i = 0; i < sizes.size(); i++){
+        cout << sizes[i] << "," << best_fit[i] << "," << list_scan[i] << ","
+             << list_scan[i] / best_fit[i] << "\n";
+    }
+    return 0;
+}
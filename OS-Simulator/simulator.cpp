@@ -8,8 +8,15 @@
 
 #include <iostream>
 #include <sstream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 
 #include "Memory.h"
+#include "EventEngine.h"
+#include "Trace.h"
 using namespace std;
 
 class Console{
@@ -25,37 +32,130 @@ public:
     string command;
     int pid_tracker = 1;
     cout << "Starting simulation... For a full list of commands, type \"commands\".\n";
-    cout << "Enter 'Q' or 'q' to quit.\n\n";
+    cout << "Enter 'q' to quit.\n\n";
 
 
     do {
         cout << ">> ";
-        getline(cin, command);
-        if(command[0] == 'A'){
-            my_system.newProcess(command, pid_tracker);
-        } else if(command [0] == 'd') {
-            my_system.requestIO(command);
-        } else if (command[0] == 'D'){
-            my_system.interruptDisk(command);
-        } else if (command[0] == 'S'){
-            my_system.snapshot(command);
-        } else if (command[0] == 't'){
-            my_system.terminate();
-        } else if (command[0] == 'q' || command[0] == 'Q'){
-            cout << "Thank you for using Priority Scheduler!\n";
-            exit(1);
-        } else if (command == "commands"){
-            cout << commands();
-        } else {
-            cout << "Invalid command.\n";
+        if(!getline(cin, command)){
+            break;
+        }
+    } while(execute(command.data(), command.data() + command.size(), pid_tracker));
+    cout << my_system.printMetrics();
+}
+
+    // Replays a trace of commands without prompts or setup questions.
+    // param mem_size: The memory size (in bytes) of the system.
+    // param num_disks: The number of hard disks in the system.
+    // param trace: The trace file to read from, or nullptr/"-" for stdin.
+    // return: 0 on success. Otherwise 1.
+    int runBatch(const unsigned int &mem_size, const unsigned int &num_disks, const char *trace){
+    TraceFile in;
+    string error;
+    if(!in.open(trace == nullptr ? "-" : trace, error)){
+        cerr << "ERROR: " << error << ".\n";
+        return 1;
+    }
+    // Commands only reach cout; keep it unsynced and unflushed between lines.
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    my_system.setupMemory(mem_size);
+    my_system.setDisk(num_disks);
+
+    const char *line, *end;
+    int pid_tracker = 1;
+    unsigned long long events = 0;
+    auto begin = chrono::steady_clock::now();
+    while(in.next(line, end)){
+        if(!execute(line, end, pid_tracker, in.line(), &events)){
+            break;
         }
-    } while(true);
+        my_system.pollDisks();
+    }
+    my_system.drainDisks();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    cout.flush();
+
+    cerr << "Replayed " << events << " events in " << seconds << " s ("
+         << (seconds > 0 ? events / seconds : 0) << " events/sec)\n";
+    cerr << my_system.printSchedulerStats();
+    cerr << my_system.printMetrics();
+    return 0;
 }
 
+    // Runs a discrete-event simulation of a random workload instead of a trace.
+    // The System's reports of every event are silenced; the statistics are printed at the end.
+    // param mem_size: The memory size (in bytes) of the system.
+    // param num_disks: The number of hard disks in the system.
+    // param config: The workload and how long it runs.
+    // return: 0 on success. Otherwise 1.
+    int runSimulation(const unsigned int &mem_size, const unsigned int &num_disks, const SimulationConfig &config){
+    my_system.setupMemory(mem_size);
+    my_system.setDisk(num_disks);
+
+    EventEngine engine(my_system, num_disks, config);
+    int pid_tracker = 1;
+    my_system.setOutput(nullptr);
+    auto begin = chrono::steady_clock::now();
+    unsigned long long events = engine.run(pid_tracker);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    my_system.setOutput(&cout);
+
+    cout << engine.printStatistics();
+    cout << my_system.printSchedulerStats();
+    cout << my_system.printMetrics();
+    cerr << "Simulated " << events << " events in " << seconds << " s ("
+         << (seconds > 0 ? events / seconds : 0) << " events/sec)\n";
+    return 0;
+}
+
+    // Gets the simulated system, to configure it before a batch run.
+    // return: A reference to the system.
+    System& getSystem(){
+        return my_system;
+    }
+
 private:
     // Instance of the system.
     System my_system;
 
+    // Parses a single command and runs it against the system.
+    // param begin: The first character of the command.
+    // param end: Past the last character of the command.
+    // param pid_tracker: The current available ID for the process.
+    // param line: The line of the trace the command is on, for errors; 0 at the console.
+    // param events: Counts the commands, without the empty lines and the comments.
+    // return: False if the command asks to quit. Otherwise true.
+    bool execute(const char *begin, const char *end, int &pid_tracker, const unsigned long long &line = 0,
+                 unsigned long long *events = nullptr){
+        Command command;
+        string error;
+        if (!CommandParser(begin, end).parse(command, error)){
+            cout << "ERROR: ";
+            if (line > 0){
+                cout << "Line " << line << ": ";
+            }
+            cout << error << ".\n";
+            return true;
+        }
+        if (command.op_ == Command::NONE){
+            return true;
+        }
+        if (events != nullptr){
+            (*events)++;
+        }
+        if (command.op_ == 'q'){
+            cout << "Thank you for using Priority Scheduler!\n";
+            return false;
+        } else if (command.op_ == Command::HELP){
+            cout << commands();
+        } else {
+            my_system.execute(command, pid_tracker);
+        }
+        return true;
+    }
+
     // Sets up the system information.
     // Gets user inputs for memory size, and number of disks.
     void setupSystem(){
@@ -130,15 +230,28 @@ private:
     string commands(){
     stringstream ss;
     ss << "Command Information:\n"
-        << "\tA <priority level> <memory size> : Creating a new process\n "
+        << "\tA <priority level> <memory size> [burst] [deadline] [core] : Creating a new process\n "
+        << "\t\tburst: CPU quanta it needs (sjf); deadline: quanta from now it must finish in (edf);\n"
+        << "\t\tcore: the only core it may run on (default any)\n"
+        << "\tc <core> : The core the Q, t, d and m commands refer to (default 0)\n"
+        << "\tQ : Process in CPU spent one time quantum\n"
         << "\tt : Terminate current process in CPU\n"
-        << "\td <disk number> : Process in CPU requests <disk number>\n"
+        << "\td <disk number> <file name> [cylinder] : Process in CPU requests <disk number>\n"
         << "\tD <disk number> : Interrupt from <disk number>. Process finished task.\n"
+        << "\tm <address> : Process in CPU references the logical <address>\n"
         << "\tS <i, r, OR m> : Snapshot of System\n"
         << "\t\t S i : IO information\n"
         << "\t\t S r : Ready Queue information\n"
-        << "\t\t S m : Memory information\n"
-        << "\t'Q' or 'q' to exit program.\n";
+        << "\t\t S m : Memory and frame table information\n"
+        << "\t\t S t : TLB hit rate and effective access time\n"
+        << "\t\t S p : Live and recycled PCB and MemFrag objects\n"
+        << "\t\t S a : Every process in the process table\n"
+        << "\t\t S s : Turnaround, wait and fragmentation metrics\n"
+        << "\t\t S <r, i, OR m> j : The snapshot as JSON lines\n"
+        << "\t\t S <r, i, OR m> d : JSON lines of what changed since the last one\n"
+        << "\tC <file> : Checkpoint the whole system to <file>\n"
+        << "\tR <file> : Restore a checkpoint into a system without processes\n"
+        << "\t'q' to exit program.\n";
         return ss.str();
  }
 };
@@ -146,20 +259,236 @@ private:
 
 
 
+// Parses a whole command line argument as a number within [low, high].
+// return: True if the argument is valid. Otherwise false.
+bool parseArgument(const char *arg, const unsigned long long &low, const unsigned long long &high,
+                   unsigned long long &value){
+    char *end = nullptr;
+    value = strtoull(arg, &end, 10);
+    return end != arg && *end == '\0' && value >= low && value <= high;
+}
+
+void usage(const char *program){
+    std::cout << "Usage: " << program << std::endl;
+    std::cout << "       " << program << " -b <memory size> <number of disks> [options] [trace file]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "\t-P <bytes> : Page size (default 4096)" << std::endl;
+    std::cout << "\t-T <entries> : TLB entries (default 64)" << std::endl;
+    std::cout << "\t-W <ways> : TLB entries per set (default 0, fully associative)" << std::endl;
+    std::cout << "\t-R <lru|fifo|random> : TLB replacement policy (default lru)" << std::endl;
+    std::cout << "\t-M <tlb ns> <memory ns> <levels> : TLB and memory access times, page walk levels (default 1 100 1)" << std::endl;
+    std::cout << "\t-D <microseconds> : Serve every disk from its own thread, taking this long per request" << std::endl;
+    std::cout << "\t-C <priority|fcfs|sjf|cfs|edf> : CPU scheduling policy (default priority)" << std::endl;
+    std::cout << "\t-d <fcfs|sstf|scan|clook> : Disk scheduling policy (default fcfs)" << std::endl;
+    std::cout << "\t-y <cylinders> : Cylinders of every disk (default 200)" << std::endl;
+    std::cout << "\t-A <list|buddy> : Memory allocator: contiguous best fit, or binary buddy system (default list)" << std::endl;
+    std::cout << "\t-K <percent> : Compact memory when a process does not fit in any hole, or when external" << std::endl;
+    std::cout << "\t\tfragmentation passes this percent (100: only when a process does not fit)" << std::endl;
+    std::cout << "\t-F : Multilevel feedback queue; demote processes that use up their time slice" << std::endl;
+    std::cout << "\t-Q <quanta>[,<quanta>...] : Quanta of a time slice at priority 0, 1, ... (default 1, or with -F" << std::endl;
+    std::cout << "\t\t1 at the top level doubling down to 64)" << std::endl;
+    std::cout << "\t-E <seconds> : Simulate a random workload for this long instead of replaying a trace" << std::endl;
+    std::cout << "\t-a, -c, -i, -s, -q, -m <distribution> : Simulated time between arrivals (default exp:100000)," << std::endl;
+    std::cout << "\t\tCPU burst (exp:50000), CPU time between disk requests (exp:20000), disk service (exp:10000)," << std::endl;
+    std::cout << "\t\tquantum (10000), all in microseconds, and process memory in bytes (uniform:1000:100000)" << std::endl;
+    std::cout << "\t\tA distribution is <value>, const:<value>, uniform:<low>:<high>, exp:<mean> or" << std::endl;
+    std::cout << "\t\tlognormal:<median>:<shape>" << std::endl;
+    std::cout << "\t-B <processes> : Mean number of processes arriving together; -a is then the time between batches" << std::endl;
+    std::cout << "\t-G <distribution> : Simulated time between arrivals of the same batch (default exp:1000)" << std::endl;
+    std::cout << "\t-w <weight>[,<weight>...] : Weights of the priority levels 0, 1, ... of new processes (default equal)" << std::endl;
+    std::cout << "\t-o <weight>[,<weight>...] : Weights of the disks 0, 1, ... of disk requests (default equal)" << std::endl;
+    std::cout << "\t-k <microseconds> : Simulated seek time per cylinder the disk head moves (default 0)" << std::endl;
+    std::cout << "\t-S <seed> : Seed of the simulated workload (default 1)" << std::endl;
+    std::cout << "\t-N <cores> : Number of CPU cores, each with its own ready queue (1-" << System::MAX_CORES
+              << ", default 1)" << std::endl;
+    std::cout << "\t-p <levels> : Number of priority levels (1-" << QueueManager::MAX_PRIORITIES << ", default 5)" << std::endl;
+}
+
 int main(int argc, const char * argv[]){
-    if (argc != 1) {
-        std::cout << "Usage: /." << argv[0] << std::endl;
-        return 1;
-    }
     Console OS;
-    OS.run();
-
-    return 0;
-}
-
-
-
-
-
-
-
+    if (argc == 1) {
+        OS.run();
+        return 0;
+    }
+    if (argc < 4 || string(argv[1]) != "-b") {
+        usage(argv[0]);
+        return 1;
+    }
+    // Batch mode: simulator -b <memory size> <number of disks> [options] [trace file]
+    unsigned long long mem_size, num_disks, value;
+    if (!parseArgument(argv[2], 1, 4000000000ULL, mem_size) || !parseArgument(argv[3], 1, 10, num_disks)) {
+        std::cerr << "ERROR: Memory must be 1-4000000000 bytes and disks 1-10.\n";
+        return 1;
+    }
+    const char *trace = nullptr;
+    unsigned long long tlb_entries = 64, tlb_ways = 0;
+    TLBPolicy tlb_policy = TLB_LRU;
+    DiskPolicy disk_policy = DISK_FCFS;
+    unsigned long long cylinders = 200;
+    SimulationConfig simulation;
+    const char *priority_mix = nullptr, *disk_mix = nullptr;
+    bool simulate = false, threaded = false;
+    for (int arg = 4; arg < argc; arg++) {
+        string option = argv[arg];
+        if (option == "-p" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, QueueManager::MAX_PRIORITIES, value)) {
+                std::cerr << "ERROR: Invalid number of priority levels.\n";
+                return 1;
+            }
+            OS.getSystem().setPriorityLevels(value);
+        } else if (option == "-N" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, System::MAX_CORES, value)) {
+                std::cerr << "ERROR: Cores must be 1-" << System::MAX_CORES << ".\n";
+                return 1;
+            }
+            OS.getSystem().setCores(value);
+        } else if (option == "-P" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, mem_size, value)) {
+                std::cerr << "ERROR: Page size must be 1-<memory size> bytes.\n";
+                return 1;
+            }
+            OS.getSystem().setPageSize(value);
+        } else if (option == "-T" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 1 << 20, tlb_entries)) {
+                std::cerr << "ERROR: TLB entries must be 1-1048576.\n";
+                return 1;
+            }
+        } else if (option == "-W" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 0, 1 << 20, tlb_ways)) {
+                std::cerr << "ERROR: Invalid number of TLB ways.\n";
+                return 1;
+            }
+        } else if (option == "-R" && arg + 1 < argc) {
+            string policy = argv[++arg];
+            if (policy == "lru") {
+                tlb_policy = TLB_LRU;
+            } else if (policy == "fifo") {
+                tlb_policy = TLB_FIFO;
+            } else if (policy == "random") {
+                tlb_policy = TLB_RANDOM;
+            } else {
+                std::cerr << "ERROR: TLB policy must be lru, fifo or random.\n";
+                return 1;
+            }
+        } else if (option == "-M" && arg + 3 < argc) {
+            unsigned long long tlb_ns, memory_ns, levels;
+            if (!parseArgument(argv[arg + 1], 0, 1000000, tlb_ns) || !parseArgument(argv[arg + 2], 0, 1000000, memory_ns)
+                || !parseArgument(argv[arg + 3], 1, 8, levels)) {
+                std::cerr << "ERROR: Invalid TLB timings.\n";
+                return 1;
+            }
+            OS.getSystem().getTLB().setTimings(tlb_ns, memory_ns, levels);
+            arg += 3;
+        } else if (option == "-D" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 0, 10000000, value)) {
+                std::cerr << "ERROR: Disk service time must be 0-10000000 microseconds.\n";
+                return 1;
+            }
+            OS.getSystem().setDiskWorkers(value);
+            threaded = true;
+        } else if (option == "-C" && arg + 1 < argc) {
+            if (!OS.getSystem().setPolicy(argv[++arg])) {
+                std::cerr << "ERROR: Scheduling policy must be priority, fcfs, sjf, cfs or edf.\n";
+                return 1;
+            }
+        } else if (option == "-d" && arg + 1 < argc) {
+            if (!parseDiskPolicy(argv[++arg], disk_policy)) {
+                std::cerr << "ERROR: Disk scheduling policy must be fcfs, sstf, scan or clook.\n";
+                return 1;
+            }
+        } else if (option == "-y" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 4000000000ULL, cylinders)) {
+                std::cerr << "ERROR: Cylinders must be 1-4000000000.\n";
+                return 1;
+            }
+        } else if (option == "-k" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 0, 1000000, simulation.seek_us_)) {
+                std::cerr << "ERROR: Seek time must be 0-1000000 microseconds per cylinder.\n";
+                return 1;
+            }
+        } else if (option == "-A" && arg + 1 < argc) {
+            if (!OS.getSystem().setAllocator(argv[++arg])) {
+                std::cerr << "ERROR: Memory allocator must be list or buddy.\n";
+                return 1;
+            }
+        } else if (option == "-K" && arg + 1 < argc) {
+            unsigned long long threshold;
+            if (!parseArgument(argv[++arg], 0, 100, threshold)) {
+                std::cerr << "ERROR: Compaction threshold must be 0-100 percent.\n";
+                return 1;
+            }
+            OS.getSystem().setCompaction(threshold);
+        } else if (option == "-F") {
+            OS.getSystem().setFeedback(true);
+        } else if (option == "-Q" && arg + 1 < argc) {
+            vector<unsigned int> quanta;
+            stringstream list(argv[++arg]);
+            string quantum;
+            while (getline(list, quantum, ',')) {
+                if (!parseArgument(quantum.c_str(), 1, 1000000, value)) {
+                    std::cerr << "ERROR: Quanta must be 1-1000000.\n";
+                    return 1;
+                }
+                quanta.push_back(value);
+            }
+            OS.getSystem().setQuanta(quanta);
+        } else if (option == "-E" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 10000000000000ULL, value)) {
+                std::cerr << "ERROR: Simulated time must be 1-10000000000000 seconds.\n";
+                return 1;
+            }
+            simulation.duration_ = value * 1000000;
+            simulate = true;
+        } else if (option.size() == 2 && string("acisqmG").find(option[1]) != string::npos && arg + 1 < argc) {
+            Distribution* distributions[] = {&simulation.arrival_, &simulation.burst_, &simulation.io_interval_,
+                                             &simulation.disk_service_, &simulation.quantum_, &simulation.memory_,
+                                             &simulation.batch_gap_};
+            if (!Distribution::parse(argv[++arg], *distributions[string("acisqmG").find(option[1])])) {
+                std::cerr << "ERROR: Invalid distribution " << argv[arg] << ".\n";
+                return 1;
+            }
+        } else if (option == "-B" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 1000000, simulation.batch_size_)) {
+                std::cerr << "ERROR: Batch size must be 1-1000000 processes.\n";
+                return 1;
+            }
+        } else if (option == "-w" && arg + 1 < argc) {
+            priority_mix = argv[++arg];
+        } else if (option == "-o" && arg + 1 < argc) {
+            disk_mix = argv[++arg];
+        } else if (option == "-S" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 0, ~0ULL, simulation.seed_)) {
+                std::cerr << "ERROR: Invalid seed.\n";
+                return 1;
+            }
+        } else if (trace == nullptr && (option == "-" || option[0] != '-')) {
+            trace = argv[arg];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    OS.getSystem().setDiskScheduling(disk_policy, cylinders);
+    if (!OS.getSystem().getTLB().setupTLB(tlb_entries, tlb_ways, tlb_policy)) {
+        std::cerr << "ERROR: TLB entries must be a multiple of the TLB ways.\n";
+        return 1;
+    }
+    if (simulate) {
+        if (threaded || trace != nullptr) {
+            std::cerr << "ERROR: A simulation takes neither a trace nor disk threads.\n";
+            return 1;
+        }
+        if (priority_mix != nullptr
+            && !Workload::parseMix(priority_mix, simulation.priority_mix_, OS.getSystem().getPriorityLevels())) {
+            std::cerr << "ERROR: Priority mix must be 1-" << OS.getSystem().getPriorityLevels()
+                      << " weights, none negative and one positive.\n";
+            return 1;
+        }
+        if (disk_mix != nullptr && !Workload::parseMix(disk_mix, simulation.disk_mix_, num_disks)) {
+            std::cerr << "ERROR: Disk mix must be 1-" << num_disks << " weights, none negative and one positive.\n";
+            return 1;
+        }
+        return OS.runSimulation(mem_size, num_disks, simulation);
+    }
+    return OS.runBatch(mem_size, num_disks, trace);
+}
@@ -0,0 +1,182 @@
+/*
+  Title          : sweep.cpp
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : replays a trace against a grid of systems in parallel
+  Purpose        : Class project
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Sweep.h"
+using namespace std;
+
+bool parseArgument(const char *arg, const unsigned long long &low, const unsigned long long &high,
+                   unsigned long long &value){
+    char *end = nullptr;
+    value = strtoull(arg, &end, 10);
+    return end != arg && *end == '\0' && value >= low && value <= high;
+}
+
+// Splits a comma separated list of values.
+vector<string> split(const char *list){
+    vector<string> values;
+    stringstream in(list);
+    string value;
+    while (getline(in, value, ',')) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+// Parses a comma separated list of numbers.
+// return: False if any of them is not a number in [low, high]. Otherwise true.
+template <typename T>
+bool parseList(const char *list, const unsigned long long &low, const unsigned long long &high, vector<T> &values){
+    values.clear();
+    unsigned long long value;
+    for (auto &item: split(list)) {
+        if (!parseArgument(item.c_str(), low, high, value)) {
+            return false;
+        }
+        values.push_back(value);
+    }
+    return !values.empty();
+}
+
+void usage(const char *program){
+    std::cout << "Usage: " << program << " [options] <trace file>" << std::endl;
+    std::cout << "Replays the trace against every combination of the values, one system per thread." << std::endl;
+    std::cout << "Options taking a list take comma separated values:" << std::endl;
+    std::cout << "\t-m <bytes>[,...] : Memory sizes (default 4000000000)" << std::endl;
+    std::cout << "\t-n <disks>[,...] : Numbers of hard disks (default 1)" << std::endl;
+    std::cout << "\t-N <cores>[,...] : Numbers of CPU cores (default 1)" << std::endl;
+    std::cout << "\t-C <priority|fcfs|sjf|cfs|edf>[,...] : CPU scheduling policies (default priority)" << std::endl;
+    std::cout << "\t-d <fcfs|sstf|scan|clook>[,...] : Disk scheduling policies (default fcfs)" << std::endl;
+    std::cout << "\t-A <list|buddy>[,...] : Memory allocators (default list)" << std::endl;
+    std::cout << "\t-P <bytes> : Page size (default 4096)" << std::endl;
+    std::cout << "\t-y <cylinders> : Cylinders of every disk (default 200)" << std::endl;
+    std::cout << "\t-p <levels> : Number of priority levels (1-" << QueueManager::MAX_PRIORITIES << ", default 5)" << std::endl;
+    std::cout << "\t-j <threads> : Systems replayed at a time (default one per hardware thread)" << std::endl;
+}
+
+int main(int argc, const char * argv[]){
+    vector<unsigned int> mem_sizes = {4000000000u};
+    vector<int> disks = {1}, cores = {1};
+    vector<string> policies = {"priority"}, allocators = {"list"};
+    vector<DiskPolicy> disk_policies = {DISK_FCFS};
+    unsigned long long threads = max(1u, thread::hardware_concurrency()), value;
+    const char *trace = nullptr;
+    Sweep sweep;
+    for (int arg = 1; arg < argc; arg++) {
+        string option = argv[arg];
+        if (option == "-m" && arg + 1 < argc) {
+            if (!parseList(argv[++arg], 1, 4000000000ULL, mem_sizes)) {
+                std::cerr << "ERROR: Memory must be 1-4000000000 bytes.\n";
+                return 1;
+            }
+        } else if (option == "-n" && arg + 1 < argc) {
+            if (!parseList(argv[++arg], 1, 10, disks)) {
+                std::cerr << "ERROR: Disks must be 1-10.\n";
+                return 1;
+            }
+        } else if (option == "-N" && arg + 1 < argc) {
+            if (!parseList(argv[++arg], 1, System::MAX_CORES, cores)) {
+                std::cerr << "ERROR: Cores must be 1-" << System::MAX_CORES << ".\n";
+                return 1;
+            }
+        } else if (option == "-C" && arg + 1 < argc) {
+            policies = split(argv[++arg]);
+            for (auto &policy: policies) {
+                unique_ptr<SchedulerPolicy> valid(newSchedulerPolicy(policy, 1));
+                if (valid == nullptr) {
+                    std::cerr << "ERROR: Scheduling policy must be priority, fcfs, sjf, cfs or edf.\n";
+                    return 1;
+                }
+            }
+        } else if (option == "-d" && arg + 1 < argc) {
+            disk_policies.clear();
+            for (auto &name: split(argv[++arg])) {
+                DiskPolicy policy;
+                if (!parseDiskPolicy(name, policy)) {
+                    std::cerr << "ERROR: Disk scheduling policy must be fcfs, sstf, scan or clook.\n";
+                    return 1;
+                }
+                disk_policies.push_back(policy);
+            }
+        } else if (option == "-A" && arg + 1 < argc) {
+            allocators = split(argv[++arg]);
+            for (auto &allocator: allocators) {
+                unique_ptr<MemoryBackend> valid(newMemoryBackend(allocator));
+                if (valid == nullptr) {
+                    std::cerr << "ERROR: Memory allocator must be list or buddy.\n";
+                    return 1;
+                }
+            }
+        } else if (option == "-P" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 4000000000ULL, value)) {
+                std::cerr << "ERROR: Page size must be 1-4000000000 bytes.\n";
+                return 1;
+            }
+            sweep.setPageSize(value);
+        } else if (option == "-y" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 4000000000ULL, value)) {
+                std::cerr << "ERROR: Cylinders must be 1-4000000000.\n";
+                return 1;
+            }
+            sweep.setCylinders(value);
+        } else if (option == "-p" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, QueueManager::MAX_PRIORITIES, value)) {
+                std::cerr << "ERROR: Invalid number of priority levels.\n";
+                return 1;
+            }
+            sweep.setPriorityLevels(value);
+        } else if (option == "-j" && arg + 1 < argc) {
+            if (!parseArgument(argv[++arg], 1, 1024, threads)) {
+                std::cerr << "ERROR: Threads must be 1-1024.\n";
+                return 1;
+            }
+        } else if (trace == nullptr && (option == "-" || option[0] != '-')) {
+            trace = argv[arg];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (trace == nullptr) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    Trace commands;
+    string error;
+    if (!commands.load(trace, error)) {
+        std::cerr << "ERROR: " << error << ".\n";
+        return 1;
+    }
+    //every run would write or read the same checkpoint file at the same time
+    for (size_t index = 0; index < commands.size(); index++) {
+        char op = commands.commands()[index].op_;
+        if (op == 'C' || op == 'R') {
+            std::cerr << "ERROR: Line " << commands.line(index) << ": A sweep cannot replay checkpoint commands (C, R).\n";
+            return 1;
+        }
+    }
+    sweep.addGrid(mem_sizes, disks, cores, policies, disk_policies, allocators);
+
+    auto begin = chrono::steady_clock::now();
+    sweep.run(commands, threads);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+
+    std::cout << sweep.printResults();
+    std::cerr << "Replayed " << commands.size() << " events against " << sweep.size() << " systems on "
+              << min<unsigned long long>(threads, sweep.size()) << " threads in " << seconds << " s\n";
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+  Title          : system_bench.cpp
+  Author         : Tushar Malakar
+  Created on     : 18th October, 2026
+  Description    : benchmark of the "System" event handlers
+  Purpose        : Class project
+*/
+
+#include <iostream>
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include "Memory.h"
+#include "Workload.h"
+using namespace std;
+
+// Prints one JSON line per measured operation.
+void report(ostream &out, const string &op, const int &ready_depth, const int &fragments, const int &ops,
+            const chrono::steady_clock::duration &elapsed){
+    double ns = chrono::duration<double, nano>(elapsed).count() / ops;
+    out << "{\"op\":\"" << op << "\",\"ready_depth\":" << ready_depth << ",\"fragments\":" << fragments
+         << ",\"ops\":" << ops << ",\"ns_per_op\":" << ns << ",\"events_per_sec\":" << 1e9 / ns << "}\n";
+}
+
+// Measures every System event handler against a system holding
+// `ready_depth` waiting processes and about `fragments` holes in memory.
+//
+// The holes come from 2 * fragments processes of mixed sizes: every other
+// one terminates and the rest are parked on disk 1, so they stay resident
+// but out of the ready queue. Then `ready_depth` priority 0 processes fill
+// the ready queue. Each phase runs `ops` priority 1 processes through one
+// handler, and the last phase terminates them.
+// param out: Where the results go; the system itself is silenced.
+void run(ostream &out, const int &ready_depth, const int &fragments, const int &ops){
+    System system;
+    system.setOutput(nullptr);
+    system.setupMemory(4000000000u);
+    system.setDisk(2);
+    int pid_tracker = 1;
+
+    for(int i = 0; i < 2 * fragments; i++){
+        system.newProcess(0, 64 + (i % 97) * 16, pid_tracker);
+        //the CPU is idle, so the new process runs at once; move it out again
+        if(i % 2 == 0){
+            system.terminate();
+        } else {
+            system.requestIO(1);
+        }
+    }
+    for(int i = 0; i < ready_depth; i++){
+        system.newProcess(0, 256, pid_tracker);
+    }
+
+    auto measure = [&](const string &op, const function<void()> &handler){
+        auto begin = chrono::steady_clock::now();
+        for(int i = 0; i < ops; i++){
+            handler();
+        }
+        auto elapsed = chrono::steady_clock::now() - begin;
+        report(out, op, ready_depth, fragments, ops, elapsed);
+    };
+
+    //arrivals preempt the priority 0 process and queue at priority 1
+    measure("newProcess", [&](){ system.newProcess(1, 128, pid_tracker); });
+    //each priority 1 process in turn waits for disk 0
+    measure("requestIO", [&](){ system.requestIO(0); });
+    //and comes back through checkCPU
+    measure("interruptDisk", [&](){ system.interruptDisk(0); });
+    //the running process is taken off the CPU, the next one dispatched,
+    //and checkCPU puts the first one back in the ready queue
+    measure("checkCPU", [&](){
+        PCB* running = system.getCPUprocess();
+        system.setCPUProcess(0, nullptr);
+        system.getNextProcess(0);
+        system.checkCPU(running);
+    });
+    measure("terminate", [&](){ system.terminate(); });
+}
+
+// Measures the workload generator alone: every draw the event engine makes
+// for a process, from its arrival to its first disk request, `ops` times.
+// Every process costs the System several events (newProcess, requestIO,
+// interruptDisk, terminate), so a simulation is not slowed down by its
+// input while these processes/s stay above the events/s that follow.
+// param workload: The name of the workload in the results.
+void generate(ostream &out, const string &workload, const SimulationConfig &config, const int &ops){
+    Workload draws(config, 5, 3, 200);
+    unsigned long long checksum = 0;
+    auto begin = chrono::steady_clock::now();
+    for(int i = 0; i < ops; i++){
+        checksum += draws.nextArrival() + draws.priority() + draws.memory() + draws.burst()
+                    + draws.ioInterval() + draws.disk() + draws.cylinder() + draws.diskService();
+    }
+    auto elapsed = chrono::steady_clock::now() - begin;
+    double ns = chrono::duration<double, nano>(elapsed).count() / ops;
+    out << "{\"op\":\"workload\",\"workload\":\"" << workload << "\",\"ops\":" << ops << ",\"ns_per_op\":" << ns
+        << ",\"processes_per_sec\":" << 1e9 / ns << ",\"checksum\":" << checksum << "}\n";
+}
+
+int main(int argc, const char * argv[]){
+    int ops = argc > 1 ? stoi(argv[1]) : 10000;
+    SimulationConfig bursty;
+    bursty.batch_size_ = 8;
+    bursty.memory_ = Distribution(Distribution::LOGNORMAL, 20000, 1.5);
+    bursty.priority_mix_ = {1, 1, 2, 4, 8};
+    bursty.disk_mix_ = {6, 2, 1};
+    generate(cout, "default", SimulationConfig(), ops * 100);
+    generate(cout, "bursty", bursty, ops * 100);
+    for(int ready_depth: {10, 1000, 100000}){
+        for(int fragments: {10, 1000, 100000}){
+            run(cout, ready_depth, fragments, ops);
+        }
+    }
+    return 0;
+}